@@ -0,0 +1,276 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/api/apiplan.c" "CMakeFiles/fftw3f.dir/api/apiplan.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/apiplan.c.o.d"
+  "/root/repo/api/configure.c" "CMakeFiles/fftw3f.dir/api/configure.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/configure.c.o.d"
+  "/root/repo/api/execute-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/execute-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-dft-c2r.c.o.d"
+  "/root/repo/api/execute-dft-ooc.c" "CMakeFiles/fftw3f.dir/api/execute-dft-ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-dft-ooc.c.o.d"
+  "/root/repo/api/execute-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/execute-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-dft-r2c.c.o.d"
+  "/root/repo/api/execute-dft.c" "CMakeFiles/fftw3f.dir/api/execute-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-dft.c.o.d"
+  "/root/repo/api/execute-fir.c" "CMakeFiles/fftw3f.dir/api/execute-fir.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-fir.c.o.d"
+  "/root/repo/api/execute-half.c" "CMakeFiles/fftw3f.dir/api/execute-half.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-half.c.o.d"
+  "/root/repo/api/execute-mdct.c" "CMakeFiles/fftw3f.dir/api/execute-mdct.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-mdct.c.o.d"
+  "/root/repo/api/execute-nufft.c" "CMakeFiles/fftw3f.dir/api/execute-nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-nufft.c.o.d"
+  "/root/repo/api/execute-r2r.c" "CMakeFiles/fftw3f.dir/api/execute-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-r2r.c.o.d"
+  "/root/repo/api/execute-split-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/execute-split-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-split-dft-c2r.c.o.d"
+  "/root/repo/api/execute-split-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/execute-split-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-split-dft-r2c.c.o.d"
+  "/root/repo/api/execute-split-dft.c" "CMakeFiles/fftw3f.dir/api/execute-split-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-split-dft.c.o.d"
+  "/root/repo/api/execute-stft.c" "CMakeFiles/fftw3f.dir/api/execute-stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute-stft.c.o.d"
+  "/root/repo/api/execute.c" "CMakeFiles/fftw3f.dir/api/execute.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/execute.c.o.d"
+  "/root/repo/api/export-wisdom-to-file.c" "CMakeFiles/fftw3f.dir/api/export-wisdom-to-file.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/export-wisdom-to-file.c.o.d"
+  "/root/repo/api/export-wisdom-to-string.c" "CMakeFiles/fftw3f.dir/api/export-wisdom-to-string.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/export-wisdom-to-string.c.o.d"
+  "/root/repo/api/export-wisdom.c" "CMakeFiles/fftw3f.dir/api/export-wisdom.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/export-wisdom.c.o.d"
+  "/root/repo/api/f77api.c" "CMakeFiles/fftw3f.dir/api/f77api.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/f77api.c.o.d"
+  "/root/repo/api/flops.c" "CMakeFiles/fftw3f.dir/api/flops.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/flops.c.o.d"
+  "/root/repo/api/forget-wisdom.c" "CMakeFiles/fftw3f.dir/api/forget-wisdom.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/forget-wisdom.c.o.d"
+  "/root/repo/api/import-system-wisdom.c" "CMakeFiles/fftw3f.dir/api/import-system-wisdom.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/import-system-wisdom.c.o.d"
+  "/root/repo/api/import-wisdom-from-file.c" "CMakeFiles/fftw3f.dir/api/import-wisdom-from-file.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/import-wisdom-from-file.c.o.d"
+  "/root/repo/api/import-wisdom-from-string.c" "CMakeFiles/fftw3f.dir/api/import-wisdom-from-string.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/import-wisdom-from-string.c.o.d"
+  "/root/repo/api/import-wisdom.c" "CMakeFiles/fftw3f.dir/api/import-wisdom.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/import-wisdom.c.o.d"
+  "/root/repo/api/malloc.c" "CMakeFiles/fftw3f.dir/api/malloc.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/malloc.c.o.d"
+  "/root/repo/api/map-r2r-kind.c" "CMakeFiles/fftw3f.dir/api/map-r2r-kind.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/map-r2r-kind.c.o.d"
+  "/root/repo/api/mapflags.c" "CMakeFiles/fftw3f.dir/api/mapflags.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mapflags.c.o.d"
+  "/root/repo/api/mkprinter-file.c" "CMakeFiles/fftw3f.dir/api/mkprinter-file.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mkprinter-file.c.o.d"
+  "/root/repo/api/mkprinter-str.c" "CMakeFiles/fftw3f.dir/api/mkprinter-str.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mkprinter-str.c.o.d"
+  "/root/repo/api/mktensor-iodims.c" "CMakeFiles/fftw3f.dir/api/mktensor-iodims.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mktensor-iodims.c.o.d"
+  "/root/repo/api/mktensor-iodims64.c" "CMakeFiles/fftw3f.dir/api/mktensor-iodims64.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mktensor-iodims64.c.o.d"
+  "/root/repo/api/mktensor-rowmajor.c" "CMakeFiles/fftw3f.dir/api/mktensor-rowmajor.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/mktensor-rowmajor.c.o.d"
+  "/root/repo/api/plan-czt.c" "CMakeFiles/fftw3f.dir/api/plan-czt.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-czt.c.o.d"
+  "/root/repo/api/plan-dft-1d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-1d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-1d.c.o.d"
+  "/root/repo/api/plan-dft-2d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-2d.c.o.d"
+  "/root/repo/api/plan-dft-3d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-3d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-3d.c.o.d"
+  "/root/repo/api/plan-dft-c2r-1d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-1d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-1d.c.o.d"
+  "/root/repo/api/plan-dft-c2r-2d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-2d.c.o.d"
+  "/root/repo/api/plan-dft-c2r-3d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-3d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r-3d.c.o.d"
+  "/root/repo/api/plan-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-c2r.c.o.d"
+  "/root/repo/api/plan-dft-ooc.c" "CMakeFiles/fftw3f.dir/api/plan-dft-ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-ooc.c.o.d"
+  "/root/repo/api/plan-dft-r2c-1d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-1d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-1d.c.o.d"
+  "/root/repo/api/plan-dft-r2c-2d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-2d.c.o.d"
+  "/root/repo/api/plan-dft-r2c-3d.c" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-3d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c-3d.c.o.d"
+  "/root/repo/api/plan-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft-r2c.c.o.d"
+  "/root/repo/api/plan-dft.c" "CMakeFiles/fftw3f.dir/api/plan-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-dft.c.o.d"
+  "/root/repo/api/plan-fir.c" "CMakeFiles/fftw3f.dir/api/plan-fir.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-fir.c.o.d"
+  "/root/repo/api/plan-guru-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-dft-c2r.c.o.d"
+  "/root/repo/api/plan-guru-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-guru-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-dft-r2c.c.o.d"
+  "/root/repo/api/plan-guru-dft.c" "CMakeFiles/fftw3f.dir/api/plan-guru-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-dft.c.o.d"
+  "/root/repo/api/plan-guru-r2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-r2r.c.o.d"
+  "/root/repo/api/plan-guru-split-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft-c2r.c.o.d"
+  "/root/repo/api/plan-guru-split-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft-r2c.c.o.d"
+  "/root/repo/api/plan-guru-split-dft.c" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru-split-dft.c.o.d"
+  "/root/repo/api/plan-guru64-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft-c2r.c.o.d"
+  "/root/repo/api/plan-guru64-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft-r2c.c.o.d"
+  "/root/repo/api/plan-guru64-dft.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-dft.c.o.d"
+  "/root/repo/api/plan-guru64-r2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-r2r.c.o.d"
+  "/root/repo/api/plan-guru64-split-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft-c2r.c.o.d"
+  "/root/repo/api/plan-guru64-split-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft-r2c.c.o.d"
+  "/root/repo/api/plan-guru64-split-dft.c" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-guru64-split-dft.c.o.d"
+  "/root/repo/api/plan-half.c" "CMakeFiles/fftw3f.dir/api/plan-half.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-half.c.o.d"
+  "/root/repo/api/plan-many-dft-c2r.c" "CMakeFiles/fftw3f.dir/api/plan-many-dft-c2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-many-dft-c2r.c.o.d"
+  "/root/repo/api/plan-many-dft-r2c.c" "CMakeFiles/fftw3f.dir/api/plan-many-dft-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-many-dft-r2c.c.o.d"
+  "/root/repo/api/plan-many-dft.c" "CMakeFiles/fftw3f.dir/api/plan-many-dft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-many-dft.c.o.d"
+  "/root/repo/api/plan-many-r2r.c" "CMakeFiles/fftw3f.dir/api/plan-many-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-many-r2r.c.o.d"
+  "/root/repo/api/plan-mdct.c" "CMakeFiles/fftw3f.dir/api/plan-mdct.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-mdct.c.o.d"
+  "/root/repo/api/plan-nufft.c" "CMakeFiles/fftw3f.dir/api/plan-nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-nufft.c.o.d"
+  "/root/repo/api/plan-r2r-1d.c" "CMakeFiles/fftw3f.dir/api/plan-r2r-1d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-r2r-1d.c.o.d"
+  "/root/repo/api/plan-r2r-2d.c" "CMakeFiles/fftw3f.dir/api/plan-r2r-2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-r2r-2d.c.o.d"
+  "/root/repo/api/plan-r2r-3d.c" "CMakeFiles/fftw3f.dir/api/plan-r2r-3d.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-r2r-3d.c.o.d"
+  "/root/repo/api/plan-r2r.c" "CMakeFiles/fftw3f.dir/api/plan-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-r2r.c.o.d"
+  "/root/repo/api/plan-stft.c" "CMakeFiles/fftw3f.dir/api/plan-stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/plan-stft.c.o.d"
+  "/root/repo/api/print-plan.c" "CMakeFiles/fftw3f.dir/api/print-plan.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/print-plan.c.o.d"
+  "/root/repo/api/rdft2-pad.c" "CMakeFiles/fftw3f.dir/api/rdft2-pad.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/rdft2-pad.c.o.d"
+  "/root/repo/api/stream-state.c" "CMakeFiles/fftw3f.dir/api/stream-state.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/stream-state.c.o.d"
+  "/root/repo/api/the-planner.c" "CMakeFiles/fftw3f.dir/api/the-planner.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/the-planner.c.o.d"
+  "/root/repo/api/version.c" "CMakeFiles/fftw3f.dir/api/version.c.o" "gcc" "CMakeFiles/fftw3f.dir/api/version.c.o.d"
+  "/root/repo/dft/aligned.c" "CMakeFiles/fftw3f.dir/dft/aligned.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/aligned.c.o.d"
+  "/root/repo/dft/batch2d.c" "CMakeFiles/fftw3f.dir/dft/batch2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/batch2d.c.o.d"
+  "/root/repo/dft/bluestein.c" "CMakeFiles/fftw3f.dir/dft/bluestein.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/bluestein.c.o.d"
+  "/root/repo/dft/buffered.c" "CMakeFiles/fftw3f.dir/dft/buffered.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/buffered.c.o.d"
+  "/root/repo/dft/conf.c" "CMakeFiles/fftw3f.dir/dft/conf.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/conf.c.o.d"
+  "/root/repo/dft/ct.c" "CMakeFiles/fftw3f.dir/dft/ct.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/ct.c.o.d"
+  "/root/repo/dft/czt.c" "CMakeFiles/fftw3f.dir/dft/czt.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/czt.c.o.d"
+  "/root/repo/dft/dftw-direct.c" "CMakeFiles/fftw3f.dir/dft/dftw-direct.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/dftw-direct.c.o.d"
+  "/root/repo/dft/dftw-directsq.c" "CMakeFiles/fftw3f.dir/dft/dftw-directsq.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/dftw-directsq.c.o.d"
+  "/root/repo/dft/dftw-generic.c" "CMakeFiles/fftw3f.dir/dft/dftw-generic.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/dftw-generic.c.o.d"
+  "/root/repo/dft/dftw-genericbuf.c" "CMakeFiles/fftw3f.dir/dft/dftw-genericbuf.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/dftw-genericbuf.c.o.d"
+  "/root/repo/dft/direct.c" "CMakeFiles/fftw3f.dir/dft/direct.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/direct.c.o.d"
+  "/root/repo/dft/generic.c" "CMakeFiles/fftw3f.dir/dft/generic.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/generic.c.o.d"
+  "/root/repo/dft/indirect-transpose.c" "CMakeFiles/fftw3f.dir/dft/indirect-transpose.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/indirect-transpose.c.o.d"
+  "/root/repo/dft/indirect.c" "CMakeFiles/fftw3f.dir/dft/indirect.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/indirect.c.o.d"
+  "/root/repo/dft/kdft-dif.c" "CMakeFiles/fftw3f.dir/dft/kdft-dif.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/kdft-dif.c.o.d"
+  "/root/repo/dft/kdft-difsq.c" "CMakeFiles/fftw3f.dir/dft/kdft-difsq.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/kdft-difsq.c.o.d"
+  "/root/repo/dft/kdft-dit.c" "CMakeFiles/fftw3f.dir/dft/kdft-dit.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/kdft-dit.c.o.d"
+  "/root/repo/dft/kdft.c" "CMakeFiles/fftw3f.dir/dft/kdft.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/kdft.c.o.d"
+  "/root/repo/dft/layout.c" "CMakeFiles/fftw3f.dir/dft/layout.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/layout.c.o.d"
+  "/root/repo/dft/nop.c" "CMakeFiles/fftw3f.dir/dft/nop.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/nop.c.o.d"
+  "/root/repo/dft/nufft.c" "CMakeFiles/fftw3f.dir/dft/nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/nufft.c.o.d"
+  "/root/repo/dft/ooc.c" "CMakeFiles/fftw3f.dir/dft/ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/ooc.c.o.d"
+  "/root/repo/dft/plan-nufft.c" "CMakeFiles/fftw3f.dir/dft/plan-nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/plan-nufft.c.o.d"
+  "/root/repo/dft/plan-ooc.c" "CMakeFiles/fftw3f.dir/dft/plan-ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/plan-ooc.c.o.d"
+  "/root/repo/dft/plan.c" "CMakeFiles/fftw3f.dir/dft/plan.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/plan.c.o.d"
+  "/root/repo/dft/problem-czt.c" "CMakeFiles/fftw3f.dir/dft/problem-czt.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/problem-czt.c.o.d"
+  "/root/repo/dft/problem-nufft.c" "CMakeFiles/fftw3f.dir/dft/problem-nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/problem-nufft.c.o.d"
+  "/root/repo/dft/problem-ooc.c" "CMakeFiles/fftw3f.dir/dft/problem-ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/problem-ooc.c.o.d"
+  "/root/repo/dft/problem.c" "CMakeFiles/fftw3f.dir/dft/problem.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/problem.c.o.d"
+  "/root/repo/dft/rader.c" "CMakeFiles/fftw3f.dir/dft/rader.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/rader.c.o.d"
+  "/root/repo/dft/rank-geq2.c" "CMakeFiles/fftw3f.dir/dft/rank-geq2.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/rank-geq2.c.o.d"
+  "/root/repo/dft/scalar/n.c" "CMakeFiles/fftw3f.dir/dft/scalar/n.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/scalar/n.c.o.d"
+  "/root/repo/dft/scalar/t.c" "CMakeFiles/fftw3f.dir/dft/scalar/t.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/scalar/t.c.o.d"
+  "/root/repo/dft/solve-czt.c" "CMakeFiles/fftw3f.dir/dft/solve-czt.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/solve-czt.c.o.d"
+  "/root/repo/dft/solve-nufft.c" "CMakeFiles/fftw3f.dir/dft/solve-nufft.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/solve-nufft.c.o.d"
+  "/root/repo/dft/solve-ooc.c" "CMakeFiles/fftw3f.dir/dft/solve-ooc.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/solve-ooc.c.o.d"
+  "/root/repo/dft/solve.c" "CMakeFiles/fftw3f.dir/dft/solve.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/solve.c.o.d"
+  "/root/repo/dft/vrank-geq1.c" "CMakeFiles/fftw3f.dir/dft/vrank-geq1.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/vrank-geq1.c.o.d"
+  "/root/repo/dft/vsplit.c" "CMakeFiles/fftw3f.dir/dft/vsplit.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/vsplit.c.o.d"
+  "/root/repo/dft/zero.c" "CMakeFiles/fftw3f.dir/dft/zero.c.o" "gcc" "CMakeFiles/fftw3f.dir/dft/zero.c.o.d"
+  "/root/repo/kernel/align.c" "CMakeFiles/fftw3f.dir/kernel/align.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/align.c.o.d"
+  "/root/repo/kernel/alloc.c" "CMakeFiles/fftw3f.dir/kernel/alloc.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/alloc.c.o.d"
+  "/root/repo/kernel/assert.c" "CMakeFiles/fftw3f.dir/kernel/assert.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/assert.c.o.d"
+  "/root/repo/kernel/awake.c" "CMakeFiles/fftw3f.dir/kernel/awake.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/awake.c.o.d"
+  "/root/repo/kernel/buffered.c" "CMakeFiles/fftw3f.dir/kernel/buffered.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/buffered.c.o.d"
+  "/root/repo/kernel/cpy1d.c" "CMakeFiles/fftw3f.dir/kernel/cpy1d.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/cpy1d.c.o.d"
+  "/root/repo/kernel/cpy2d-pair.c" "CMakeFiles/fftw3f.dir/kernel/cpy2d-pair.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/cpy2d-pair.c.o.d"
+  "/root/repo/kernel/cpy2d.c" "CMakeFiles/fftw3f.dir/kernel/cpy2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/cpy2d.c.o.d"
+  "/root/repo/kernel/ct.c" "CMakeFiles/fftw3f.dir/kernel/ct.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/ct.c.o.d"
+  "/root/repo/kernel/debug.c" "CMakeFiles/fftw3f.dir/kernel/debug.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/debug.c.o.d"
+  "/root/repo/kernel/extract-reim.c" "CMakeFiles/fftw3f.dir/kernel/extract-reim.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/extract-reim.c.o.d"
+  "/root/repo/kernel/hash.c" "CMakeFiles/fftw3f.dir/kernel/hash.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/hash.c.o.d"
+  "/root/repo/kernel/iabs.c" "CMakeFiles/fftw3f.dir/kernel/iabs.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/iabs.c.o.d"
+  "/root/repo/kernel/kalloc.c" "CMakeFiles/fftw3f.dir/kernel/kalloc.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/kalloc.c.o.d"
+  "/root/repo/kernel/md5-1.c" "CMakeFiles/fftw3f.dir/kernel/md5-1.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/md5-1.c.o.d"
+  "/root/repo/kernel/md5.c" "CMakeFiles/fftw3f.dir/kernel/md5.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/md5.c.o.d"
+  "/root/repo/kernel/minmax.c" "CMakeFiles/fftw3f.dir/kernel/minmax.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/minmax.c.o.d"
+  "/root/repo/kernel/ops.c" "CMakeFiles/fftw3f.dir/kernel/ops.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/ops.c.o.d"
+  "/root/repo/kernel/pickdim.c" "CMakeFiles/fftw3f.dir/kernel/pickdim.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/pickdim.c.o.d"
+  "/root/repo/kernel/plan.c" "CMakeFiles/fftw3f.dir/kernel/plan.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/plan.c.o.d"
+  "/root/repo/kernel/planner.c" "CMakeFiles/fftw3f.dir/kernel/planner.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/planner.c.o.d"
+  "/root/repo/kernel/primes.c" "CMakeFiles/fftw3f.dir/kernel/primes.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/primes.c.o.d"
+  "/root/repo/kernel/print.c" "CMakeFiles/fftw3f.dir/kernel/print.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/print.c.o.d"
+  "/root/repo/kernel/problem.c" "CMakeFiles/fftw3f.dir/kernel/problem.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/problem.c.o.d"
+  "/root/repo/kernel/rader.c" "CMakeFiles/fftw3f.dir/kernel/rader.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/rader.c.o.d"
+  "/root/repo/kernel/scan.c" "CMakeFiles/fftw3f.dir/kernel/scan.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/scan.c.o.d"
+  "/root/repo/kernel/solver.c" "CMakeFiles/fftw3f.dir/kernel/solver.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/solver.c.o.d"
+  "/root/repo/kernel/solvtab.c" "CMakeFiles/fftw3f.dir/kernel/solvtab.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/solvtab.c.o.d"
+  "/root/repo/kernel/storage.c" "CMakeFiles/fftw3f.dir/kernel/storage.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/storage.c.o.d"
+  "/root/repo/kernel/stride.c" "CMakeFiles/fftw3f.dir/kernel/stride.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/stride.c.o.d"
+  "/root/repo/kernel/tensor.c" "CMakeFiles/fftw3f.dir/kernel/tensor.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor.c.o.d"
+  "/root/repo/kernel/tensor1.c" "CMakeFiles/fftw3f.dir/kernel/tensor1.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor1.c.o.d"
+  "/root/repo/kernel/tensor2.c" "CMakeFiles/fftw3f.dir/kernel/tensor2.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor2.c.o.d"
+  "/root/repo/kernel/tensor3.c" "CMakeFiles/fftw3f.dir/kernel/tensor3.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor3.c.o.d"
+  "/root/repo/kernel/tensor4.c" "CMakeFiles/fftw3f.dir/kernel/tensor4.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor4.c.o.d"
+  "/root/repo/kernel/tensor5.c" "CMakeFiles/fftw3f.dir/kernel/tensor5.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor5.c.o.d"
+  "/root/repo/kernel/tensor7.c" "CMakeFiles/fftw3f.dir/kernel/tensor7.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor7.c.o.d"
+  "/root/repo/kernel/tensor8.c" "CMakeFiles/fftw3f.dir/kernel/tensor8.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor8.c.o.d"
+  "/root/repo/kernel/tensor9.c" "CMakeFiles/fftw3f.dir/kernel/tensor9.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tensor9.c.o.d"
+  "/root/repo/kernel/tile2d.c" "CMakeFiles/fftw3f.dir/kernel/tile2d.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/tile2d.c.o.d"
+  "/root/repo/kernel/timer.c" "CMakeFiles/fftw3f.dir/kernel/timer.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/timer.c.o.d"
+  "/root/repo/kernel/transpose.c" "CMakeFiles/fftw3f.dir/kernel/transpose.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/transpose.c.o.d"
+  "/root/repo/kernel/trig.c" "CMakeFiles/fftw3f.dir/kernel/trig.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/trig.c.o.d"
+  "/root/repo/kernel/twiddle.c" "CMakeFiles/fftw3f.dir/kernel/twiddle.c.o" "gcc" "CMakeFiles/fftw3f.dir/kernel/twiddle.c.o.d"
+  "/root/repo/rdft/buffered.c" "CMakeFiles/fftw3f.dir/rdft/buffered.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/buffered.c.o.d"
+  "/root/repo/rdft/buffered2.c" "CMakeFiles/fftw3f.dir/rdft/buffered2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/buffered2.c.o.d"
+  "/root/repo/rdft/conf.c" "CMakeFiles/fftw3f.dir/rdft/conf.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/conf.c.o.d"
+  "/root/repo/rdft/ct-hc2c-direct.c" "CMakeFiles/fftw3f.dir/rdft/ct-hc2c-direct.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/ct-hc2c-direct.c.o.d"
+  "/root/repo/rdft/ct-hc2c.c" "CMakeFiles/fftw3f.dir/rdft/ct-hc2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/ct-hc2c.c.o.d"
+  "/root/repo/rdft/dft-r2hc.c" "CMakeFiles/fftw3f.dir/rdft/dft-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/dft-r2hc.c.o.d"
+  "/root/repo/rdft/dht-r2hc.c" "CMakeFiles/fftw3f.dir/rdft/dht-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/dht-r2hc.c.o.d"
+  "/root/repo/rdft/dht-rader.c" "CMakeFiles/fftw3f.dir/rdft/dht-rader.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/dht-rader.c.o.d"
+  "/root/repo/rdft/direct-r2c.c" "CMakeFiles/fftw3f.dir/rdft/direct-r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/direct-r2c.c.o.d"
+  "/root/repo/rdft/direct-r2r.c" "CMakeFiles/fftw3f.dir/rdft/direct-r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/direct-r2r.c.o.d"
+  "/root/repo/rdft/direct2.c" "CMakeFiles/fftw3f.dir/rdft/direct2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/direct2.c.o.d"
+  "/root/repo/rdft/fir.c" "CMakeFiles/fftw3f.dir/rdft/fir.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/fir.c.o.d"
+  "/root/repo/rdft/generic.c" "CMakeFiles/fftw3f.dir/rdft/generic.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/generic.c.o.d"
+  "/root/repo/rdft/half.c" "CMakeFiles/fftw3f.dir/rdft/half.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/half.c.o.d"
+  "/root/repo/rdft/hc2hc-direct.c" "CMakeFiles/fftw3f.dir/rdft/hc2hc-direct.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/hc2hc-direct.c.o.d"
+  "/root/repo/rdft/hc2hc-generic.c" "CMakeFiles/fftw3f.dir/rdft/hc2hc-generic.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/hc2hc-generic.c.o.d"
+  "/root/repo/rdft/hc2hc.c" "CMakeFiles/fftw3f.dir/rdft/hc2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/hc2hc.c.o.d"
+  "/root/repo/rdft/hcpairs.c" "CMakeFiles/fftw3f.dir/rdft/hcpairs.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/hcpairs.c.o.d"
+  "/root/repo/rdft/indirect.c" "CMakeFiles/fftw3f.dir/rdft/indirect.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/indirect.c.o.d"
+  "/root/repo/rdft/khc2c.c" "CMakeFiles/fftw3f.dir/rdft/khc2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/khc2c.c.o.d"
+  "/root/repo/rdft/khc2hc.c" "CMakeFiles/fftw3f.dir/rdft/khc2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/khc2hc.c.o.d"
+  "/root/repo/rdft/kr2c.c" "CMakeFiles/fftw3f.dir/rdft/kr2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/kr2c.c.o.d"
+  "/root/repo/rdft/kr2r.c" "CMakeFiles/fftw3f.dir/rdft/kr2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/kr2r.c.o.d"
+  "/root/repo/rdft/nop.c" "CMakeFiles/fftw3f.dir/rdft/nop.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/nop.c.o.d"
+  "/root/repo/rdft/nop2.c" "CMakeFiles/fftw3f.dir/rdft/nop2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/nop2.c.o.d"
+  "/root/repo/rdft/plan-half.c" "CMakeFiles/fftw3f.dir/rdft/plan-half.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/plan-half.c.o.d"
+  "/root/repo/rdft/plan-stft.c" "CMakeFiles/fftw3f.dir/rdft/plan-stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/plan-stft.c.o.d"
+  "/root/repo/rdft/plan-stream.c" "CMakeFiles/fftw3f.dir/rdft/plan-stream.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/plan-stream.c.o.d"
+  "/root/repo/rdft/plan.c" "CMakeFiles/fftw3f.dir/rdft/plan.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/plan.c.o.d"
+  "/root/repo/rdft/plan2.c" "CMakeFiles/fftw3f.dir/rdft/plan2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/plan2.c.o.d"
+  "/root/repo/rdft/problem-fir.c" "CMakeFiles/fftw3f.dir/rdft/problem-fir.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/problem-fir.c.o.d"
+  "/root/repo/rdft/problem-half.c" "CMakeFiles/fftw3f.dir/rdft/problem-half.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/problem-half.c.o.d"
+  "/root/repo/rdft/problem-stft.c" "CMakeFiles/fftw3f.dir/rdft/problem-stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/problem-stft.c.o.d"
+  "/root/repo/rdft/problem.c" "CMakeFiles/fftw3f.dir/rdft/problem.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/problem.c.o.d"
+  "/root/repo/rdft/problem2.c" "CMakeFiles/fftw3f.dir/rdft/problem2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/problem2.c.o.d"
+  "/root/repo/rdft/rank-geq2-rdft2.c" "CMakeFiles/fftw3f.dir/rdft/rank-geq2-rdft2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rank-geq2-rdft2.c.o.d"
+  "/root/repo/rdft/rank-geq2.c" "CMakeFiles/fftw3f.dir/rdft/rank-geq2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rank-geq2.c.o.d"
+  "/root/repo/rdft/rank0-rdft2.c" "CMakeFiles/fftw3f.dir/rdft/rank0-rdft2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rank0-rdft2.c.o.d"
+  "/root/repo/rdft/rank0.c" "CMakeFiles/fftw3f.dir/rdft/rank0.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rank0.c.o.d"
+  "/root/repo/rdft/rdft-dht.c" "CMakeFiles/fftw3f.dir/rdft/rdft-dht.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rdft-dht.c.o.d"
+  "/root/repo/rdft/rdft2-inplace-strides.c" "CMakeFiles/fftw3f.dir/rdft/rdft2-inplace-strides.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rdft2-inplace-strides.c.o.d"
+  "/root/repo/rdft/rdft2-rdft.c" "CMakeFiles/fftw3f.dir/rdft/rdft2-rdft.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rdft2-rdft.c.o.d"
+  "/root/repo/rdft/rdft2-strides.c" "CMakeFiles/fftw3f.dir/rdft/rdft2-strides.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rdft2-strides.c.o.d"
+  "/root/repo/rdft/rdft2-tensor-max-index.c" "CMakeFiles/fftw3f.dir/rdft/rdft2-tensor-max-index.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/rdft2-tensor-max-index.c.o.d"
+  "/root/repo/rdft/scalar/hc2c.c" "CMakeFiles/fftw3f.dir/rdft/scalar/hc2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/scalar/hc2c.c.o.d"
+  "/root/repo/rdft/scalar/hfb.c" "CMakeFiles/fftw3f.dir/rdft/scalar/hfb.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/scalar/hfb.c.o.d"
+  "/root/repo/rdft/scalar/r2c.c" "CMakeFiles/fftw3f.dir/rdft/scalar/r2c.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/scalar/r2c.c.o.d"
+  "/root/repo/rdft/scalar/r2r.c" "CMakeFiles/fftw3f.dir/rdft/scalar/r2r.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/scalar/r2r.c.o.d"
+  "/root/repo/rdft/simd/avx2/storage.c" "CMakeFiles/fftw3f.dir/rdft/simd/avx2/storage.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/simd/avx2/storage.c.o.d"
+  "/root/repo/rdft/solve-fir.c" "CMakeFiles/fftw3f.dir/rdft/solve-fir.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/solve-fir.c.o.d"
+  "/root/repo/rdft/solve-half.c" "CMakeFiles/fftw3f.dir/rdft/solve-half.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/solve-half.c.o.d"
+  "/root/repo/rdft/solve-stft.c" "CMakeFiles/fftw3f.dir/rdft/solve-stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/solve-stft.c.o.d"
+  "/root/repo/rdft/solve.c" "CMakeFiles/fftw3f.dir/rdft/solve.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/solve.c.o.d"
+  "/root/repo/rdft/solve2.c" "CMakeFiles/fftw3f.dir/rdft/solve2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/solve2.c.o.d"
+  "/root/repo/rdft/stft.c" "CMakeFiles/fftw3f.dir/rdft/stft.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/stft.c.o.d"
+  "/root/repo/rdft/vrank-geq1-rdft2.c" "CMakeFiles/fftw3f.dir/rdft/vrank-geq1-rdft2.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/vrank-geq1-rdft2.c.o.d"
+  "/root/repo/rdft/vrank-geq1.c" "CMakeFiles/fftw3f.dir/rdft/vrank-geq1.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/vrank-geq1.c.o.d"
+  "/root/repo/rdft/vrank3-transpose.c" "CMakeFiles/fftw3f.dir/rdft/vrank3-transpose.c.o" "gcc" "CMakeFiles/fftw3f.dir/rdft/vrank3-transpose.c.o.d"
+  "/root/repo/reodft/conf.c" "CMakeFiles/fftw3f.dir/reodft/conf.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/conf.c.o.d"
+  "/root/repo/reodft/mdct.c" "CMakeFiles/fftw3f.dir/reodft/mdct.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/mdct.c.o.d"
+  "/root/repo/reodft/problem-mdct.c" "CMakeFiles/fftw3f.dir/reodft/problem-mdct.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/problem-mdct.c.o.d"
+  "/root/repo/reodft/redft00e-r2hc-pad.c" "CMakeFiles/fftw3f.dir/reodft/redft00e-r2hc-pad.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/redft00e-r2hc-pad.c.o.d"
+  "/root/repo/reodft/redft00e-r2hc.c" "CMakeFiles/fftw3f.dir/reodft/redft00e-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/redft00e-r2hc.c.o.d"
+  "/root/repo/reodft/reodft00e-splitradix.c" "CMakeFiles/fftw3f.dir/reodft/reodft00e-splitradix.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft00e-splitradix.c.o.d"
+  "/root/repo/reodft/reodft010e-r2hc.c" "CMakeFiles/fftw3f.dir/reodft/reodft010e-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft010e-r2hc.c.o.d"
+  "/root/repo/reodft/reodft010e-radix2.c" "CMakeFiles/fftw3f.dir/reodft/reodft010e-radix2.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft010e-radix2.c.o.d"
+  "/root/repo/reodft/reodft11e-r2hc-odd.c" "CMakeFiles/fftw3f.dir/reodft/reodft11e-r2hc-odd.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft11e-r2hc-odd.c.o.d"
+  "/root/repo/reodft/reodft11e-r2hc.c" "CMakeFiles/fftw3f.dir/reodft/reodft11e-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft11e-r2hc.c.o.d"
+  "/root/repo/reodft/reodft11e-radix2.c" "CMakeFiles/fftw3f.dir/reodft/reodft11e-radix2.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/reodft11e-radix2.c.o.d"
+  "/root/repo/reodft/rodft00e-r2hc-pad.c" "CMakeFiles/fftw3f.dir/reodft/rodft00e-r2hc-pad.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/rodft00e-r2hc-pad.c.o.d"
+  "/root/repo/reodft/rodft00e-r2hc.c" "CMakeFiles/fftw3f.dir/reodft/rodft00e-r2hc.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/rodft00e-r2hc.c.o.d"
+  "/root/repo/reodft/solve-mdct.c" "CMakeFiles/fftw3f.dir/reodft/solve-mdct.c.o" "gcc" "CMakeFiles/fftw3f.dir/reodft/solve-mdct.c.o.d"
+  "/root/repo/simd-support/altivec.c" "CMakeFiles/fftw3f.dir/simd-support/altivec.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/altivec.c.o.d"
+  "/root/repo/simd-support/avx-128-fma.c" "CMakeFiles/fftw3f.dir/simd-support/avx-128-fma.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/avx-128-fma.c.o.d"
+  "/root/repo/simd-support/avx.c" "CMakeFiles/fftw3f.dir/simd-support/avx.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/avx.c.o.d"
+  "/root/repo/simd-support/avx2.c" "CMakeFiles/fftw3f.dir/simd-support/avx2.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/avx2.c.o.d"
+  "/root/repo/simd-support/avx512.c" "CMakeFiles/fftw3f.dir/simd-support/avx512.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/avx512.c.o.d"
+  "/root/repo/simd-support/kcvi.c" "CMakeFiles/fftw3f.dir/simd-support/kcvi.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/kcvi.c.o.d"
+  "/root/repo/simd-support/lasx.c" "CMakeFiles/fftw3f.dir/simd-support/lasx.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/lasx.c.o.d"
+  "/root/repo/simd-support/lsx.c" "CMakeFiles/fftw3f.dir/simd-support/lsx.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/lsx.c.o.d"
+  "/root/repo/simd-support/neon.c" "CMakeFiles/fftw3f.dir/simd-support/neon.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/neon.c.o.d"
+  "/root/repo/simd-support/sse2.c" "CMakeFiles/fftw3f.dir/simd-support/sse2.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/sse2.c.o.d"
+  "/root/repo/simd-support/sve-getwidth.c" "CMakeFiles/fftw3f.dir/simd-support/sve-getwidth.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/sve-getwidth.c.o.d"
+  "/root/repo/simd-support/sve.c" "CMakeFiles/fftw3f.dir/simd-support/sve.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/sve.c.o.d"
+  "/root/repo/simd-support/taint.c" "CMakeFiles/fftw3f.dir/simd-support/taint.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/taint.c.o.d"
+  "/root/repo/simd-support/vsx.c" "CMakeFiles/fftw3f.dir/simd-support/vsx.c.o" "gcc" "CMakeFiles/fftw3f.dir/simd-support/vsx.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_avx2f/libfftw3f.so" "/root/repo/_gate_avx2f/libfftw3f.so.3"
+  "/root/repo/_gate_avx2f/libfftw3f.so.3.6.9" "/root/repo/_gate_avx2f/libfftw3f.so.3"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/apitest.dir/tests/apitest.c.o"
+  "CMakeFiles/apitest.dir/tests/apitest.c.o.d"
+  "apitest"
+  "apitest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/apitest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
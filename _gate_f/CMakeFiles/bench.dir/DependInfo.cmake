@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libbench2/after-ccopy-from.c" "CMakeFiles/bench.dir/libbench2/after-ccopy-from.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-ccopy-from.c.o.d"
+  "/root/repo/libbench2/after-ccopy-to.c" "CMakeFiles/bench.dir/libbench2/after-ccopy-to.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-ccopy-to.c.o.d"
+  "/root/repo/libbench2/after-hccopy-from.c" "CMakeFiles/bench.dir/libbench2/after-hccopy-from.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-hccopy-from.c.o.d"
+  "/root/repo/libbench2/after-hccopy-to.c" "CMakeFiles/bench.dir/libbench2/after-hccopy-to.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-hccopy-to.c.o.d"
+  "/root/repo/libbench2/after-rcopy-from.c" "CMakeFiles/bench.dir/libbench2/after-rcopy-from.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-rcopy-from.c.o.d"
+  "/root/repo/libbench2/after-rcopy-to.c" "CMakeFiles/bench.dir/libbench2/after-rcopy-to.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/after-rcopy-to.c.o.d"
+  "/root/repo/libbench2/allocate.c" "CMakeFiles/bench.dir/libbench2/allocate.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/allocate.c.o.d"
+  "/root/repo/libbench2/aset.c" "CMakeFiles/bench.dir/libbench2/aset.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/aset.c.o.d"
+  "/root/repo/libbench2/bench-cost-postprocess.c" "CMakeFiles/bench.dir/libbench2/bench-cost-postprocess.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/bench-cost-postprocess.c.o.d"
+  "/root/repo/libbench2/bench-exit.c" "CMakeFiles/bench.dir/libbench2/bench-exit.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/bench-exit.c.o.d"
+  "/root/repo/libbench2/bench-main.c" "CMakeFiles/bench.dir/libbench2/bench-main.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/bench-main.c.o.d"
+  "/root/repo/libbench2/can-do.c" "CMakeFiles/bench.dir/libbench2/can-do.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/can-do.c.o.d"
+  "/root/repo/libbench2/caset.c" "CMakeFiles/bench.dir/libbench2/caset.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/caset.c.o.d"
+  "/root/repo/libbench2/dotens2.c" "CMakeFiles/bench.dir/libbench2/dotens2.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/dotens2.c.o.d"
+  "/root/repo/libbench2/info.c" "CMakeFiles/bench.dir/libbench2/info.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/info.c.o.d"
+  "/root/repo/libbench2/main.c" "CMakeFiles/bench.dir/libbench2/main.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/main.c.o.d"
+  "/root/repo/libbench2/mflops.c" "CMakeFiles/bench.dir/libbench2/mflops.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/mflops.c.o.d"
+  "/root/repo/libbench2/mp.c" "CMakeFiles/bench.dir/libbench2/mp.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/mp.c.o.d"
+  "/root/repo/libbench2/my-getopt.c" "CMakeFiles/bench.dir/libbench2/my-getopt.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/my-getopt.c.o.d"
+  "/root/repo/libbench2/ovtpvt.c" "CMakeFiles/bench.dir/libbench2/ovtpvt.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/ovtpvt.c.o.d"
+  "/root/repo/libbench2/pow2.c" "CMakeFiles/bench.dir/libbench2/pow2.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/pow2.c.o.d"
+  "/root/repo/libbench2/problem.c" "CMakeFiles/bench.dir/libbench2/problem.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/problem.c.o.d"
+  "/root/repo/libbench2/report.c" "CMakeFiles/bench.dir/libbench2/report.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/report.c.o.d"
+  "/root/repo/libbench2/speed.c" "CMakeFiles/bench.dir/libbench2/speed.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/speed.c.o.d"
+  "/root/repo/libbench2/tensor.c" "CMakeFiles/bench.dir/libbench2/tensor.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/tensor.c.o.d"
+  "/root/repo/libbench2/timer.c" "CMakeFiles/bench.dir/libbench2/timer.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/timer.c.o.d"
+  "/root/repo/libbench2/util.c" "CMakeFiles/bench.dir/libbench2/util.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/util.c.o.d"
+  "/root/repo/libbench2/verify-dft.c" "CMakeFiles/bench.dir/libbench2/verify-dft.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/verify-dft.c.o.d"
+  "/root/repo/libbench2/verify-lib.c" "CMakeFiles/bench.dir/libbench2/verify-lib.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/verify-lib.c.o.d"
+  "/root/repo/libbench2/verify-r2r.c" "CMakeFiles/bench.dir/libbench2/verify-r2r.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/verify-r2r.c.o.d"
+  "/root/repo/libbench2/verify-rdft2.c" "CMakeFiles/bench.dir/libbench2/verify-rdft2.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/verify-rdft2.c.o.d"
+  "/root/repo/libbench2/verify.c" "CMakeFiles/bench.dir/libbench2/verify.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/verify.c.o.d"
+  "/root/repo/libbench2/zero.c" "CMakeFiles/bench.dir/libbench2/zero.c.o" "gcc" "CMakeFiles/bench.dir/libbench2/zero.c.o.d"
+  "/root/repo/tests/bench.c" "CMakeFiles/bench.dir/tests/bench.c.o" "gcc" "CMakeFiles/bench.dir/tests/bench.c.o.d"
+  "/root/repo/tests/fftw-bench.c" "CMakeFiles/bench.dir/tests/fftw-bench.c.o" "gcc" "CMakeFiles/bench.dir/tests/fftw-bench.c.o.d"
+  "/root/repo/tests/hook.c" "CMakeFiles/bench.dir/tests/hook.c.o" "gcc" "CMakeFiles/bench.dir/tests/hook.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_f/CMakeFiles/fftw3f.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
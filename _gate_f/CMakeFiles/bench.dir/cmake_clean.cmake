@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench.dir/libbench2/after-ccopy-from.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-ccopy-from.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/after-ccopy-to.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-ccopy-to.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/after-hccopy-from.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-hccopy-from.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/after-hccopy-to.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-hccopy-to.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/after-rcopy-from.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-rcopy-from.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/after-rcopy-to.c.o"
+  "CMakeFiles/bench.dir/libbench2/after-rcopy-to.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/allocate.c.o"
+  "CMakeFiles/bench.dir/libbench2/allocate.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/aset.c.o"
+  "CMakeFiles/bench.dir/libbench2/aset.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/bench-cost-postprocess.c.o"
+  "CMakeFiles/bench.dir/libbench2/bench-cost-postprocess.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/bench-exit.c.o"
+  "CMakeFiles/bench.dir/libbench2/bench-exit.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/bench-main.c.o"
+  "CMakeFiles/bench.dir/libbench2/bench-main.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/can-do.c.o"
+  "CMakeFiles/bench.dir/libbench2/can-do.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/caset.c.o"
+  "CMakeFiles/bench.dir/libbench2/caset.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/dotens2.c.o"
+  "CMakeFiles/bench.dir/libbench2/dotens2.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/info.c.o"
+  "CMakeFiles/bench.dir/libbench2/info.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/main.c.o"
+  "CMakeFiles/bench.dir/libbench2/main.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/mflops.c.o"
+  "CMakeFiles/bench.dir/libbench2/mflops.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/mp.c.o"
+  "CMakeFiles/bench.dir/libbench2/mp.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/my-getopt.c.o"
+  "CMakeFiles/bench.dir/libbench2/my-getopt.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/ovtpvt.c.o"
+  "CMakeFiles/bench.dir/libbench2/ovtpvt.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/pow2.c.o"
+  "CMakeFiles/bench.dir/libbench2/pow2.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/problem.c.o"
+  "CMakeFiles/bench.dir/libbench2/problem.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/report.c.o"
+  "CMakeFiles/bench.dir/libbench2/report.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/speed.c.o"
+  "CMakeFiles/bench.dir/libbench2/speed.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/tensor.c.o"
+  "CMakeFiles/bench.dir/libbench2/tensor.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/timer.c.o"
+  "CMakeFiles/bench.dir/libbench2/timer.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/util.c.o"
+  "CMakeFiles/bench.dir/libbench2/util.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/verify-dft.c.o"
+  "CMakeFiles/bench.dir/libbench2/verify-dft.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/verify-lib.c.o"
+  "CMakeFiles/bench.dir/libbench2/verify-lib.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/verify-r2r.c.o"
+  "CMakeFiles/bench.dir/libbench2/verify-r2r.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/verify-rdft2.c.o"
+  "CMakeFiles/bench.dir/libbench2/verify-rdft2.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/verify.c.o"
+  "CMakeFiles/bench.dir/libbench2/verify.c.o.d"
+  "CMakeFiles/bench.dir/libbench2/zero.c.o"
+  "CMakeFiles/bench.dir/libbench2/zero.c.o.d"
+  "CMakeFiles/bench.dir/tests/bench.c.o"
+  "CMakeFiles/bench.dir/tests/bench.c.o.d"
+  "CMakeFiles/bench.dir/tests/fftw-bench.c.o"
+  "CMakeFiles/bench.dir/tests/fftw-bench.c.o.d"
+  "CMakeFiles/bench.dir/tests/hook.c.o"
+  "CMakeFiles/bench.dir/tests/hook.c.o.d"
+  "bench"
+  "bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
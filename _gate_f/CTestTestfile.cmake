@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_f
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(api "/root/repo/_gate_f/apitest")
+set_tests_properties(api PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;511;add_test;/root/repo/CMakeLists.txt;0;")
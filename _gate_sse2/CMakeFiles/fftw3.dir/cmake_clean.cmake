@@ -0,0 +1,511 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fftw3.dir/api/apiplan.c.o"
+  "CMakeFiles/fftw3.dir/api/apiplan.c.o.d"
+  "CMakeFiles/fftw3.dir/api/configure.c.o"
+  "CMakeFiles/fftw3.dir/api/configure.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-dft-ooc.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-dft-ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-fir.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-fir.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-half.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-half.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-mdct.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-mdct.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-nufft.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-r2r.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-split-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute-stft.c.o"
+  "CMakeFiles/fftw3.dir/api/execute-stft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/execute.c.o"
+  "CMakeFiles/fftw3.dir/api/execute.c.o.d"
+  "CMakeFiles/fftw3.dir/api/export-wisdom-to-file.c.o"
+  "CMakeFiles/fftw3.dir/api/export-wisdom-to-file.c.o.d"
+  "CMakeFiles/fftw3.dir/api/export-wisdom-to-string.c.o"
+  "CMakeFiles/fftw3.dir/api/export-wisdom-to-string.c.o.d"
+  "CMakeFiles/fftw3.dir/api/export-wisdom.c.o"
+  "CMakeFiles/fftw3.dir/api/export-wisdom.c.o.d"
+  "CMakeFiles/fftw3.dir/api/f77api.c.o"
+  "CMakeFiles/fftw3.dir/api/f77api.c.o.d"
+  "CMakeFiles/fftw3.dir/api/flops.c.o"
+  "CMakeFiles/fftw3.dir/api/flops.c.o.d"
+  "CMakeFiles/fftw3.dir/api/forget-wisdom.c.o"
+  "CMakeFiles/fftw3.dir/api/forget-wisdom.c.o.d"
+  "CMakeFiles/fftw3.dir/api/import-system-wisdom.c.o"
+  "CMakeFiles/fftw3.dir/api/import-system-wisdom.c.o.d"
+  "CMakeFiles/fftw3.dir/api/import-wisdom-from-file.c.o"
+  "CMakeFiles/fftw3.dir/api/import-wisdom-from-file.c.o.d"
+  "CMakeFiles/fftw3.dir/api/import-wisdom-from-string.c.o"
+  "CMakeFiles/fftw3.dir/api/import-wisdom-from-string.c.o.d"
+  "CMakeFiles/fftw3.dir/api/import-wisdom.c.o"
+  "CMakeFiles/fftw3.dir/api/import-wisdom.c.o.d"
+  "CMakeFiles/fftw3.dir/api/malloc.c.o"
+  "CMakeFiles/fftw3.dir/api/malloc.c.o.d"
+  "CMakeFiles/fftw3.dir/api/map-r2r-kind.c.o"
+  "CMakeFiles/fftw3.dir/api/map-r2r-kind.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mapflags.c.o"
+  "CMakeFiles/fftw3.dir/api/mapflags.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mkprinter-file.c.o"
+  "CMakeFiles/fftw3.dir/api/mkprinter-file.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mkprinter-str.c.o"
+  "CMakeFiles/fftw3.dir/api/mkprinter-str.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mktensor-iodims.c.o"
+  "CMakeFiles/fftw3.dir/api/mktensor-iodims.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mktensor-iodims64.c.o"
+  "CMakeFiles/fftw3.dir/api/mktensor-iodims64.c.o.d"
+  "CMakeFiles/fftw3.dir/api/mktensor-rowmajor.c.o"
+  "CMakeFiles/fftw3.dir/api/mktensor-rowmajor.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-czt.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-czt.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-1d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-1d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-2d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-2d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-3d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-3d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-1d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-1d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-2d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-2d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-3d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r-3d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-ooc.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-1d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-1d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-2d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-2d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-3d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c-3d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-fir.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-fir.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-r2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru-split-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-r2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-guru64-split-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-half.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-half.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft-c2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft-c2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft-r2c.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-many-dft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-many-r2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-many-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-mdct.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-mdct.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-nufft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-1d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-1d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-2d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-2d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-3d.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-r2r-3d.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-r2r.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/api/plan-stft.c.o"
+  "CMakeFiles/fftw3.dir/api/plan-stft.c.o.d"
+  "CMakeFiles/fftw3.dir/api/print-plan.c.o"
+  "CMakeFiles/fftw3.dir/api/print-plan.c.o.d"
+  "CMakeFiles/fftw3.dir/api/rdft2-pad.c.o"
+  "CMakeFiles/fftw3.dir/api/rdft2-pad.c.o.d"
+  "CMakeFiles/fftw3.dir/api/stream-state.c.o"
+  "CMakeFiles/fftw3.dir/api/stream-state.c.o.d"
+  "CMakeFiles/fftw3.dir/api/the-planner.c.o"
+  "CMakeFiles/fftw3.dir/api/the-planner.c.o.d"
+  "CMakeFiles/fftw3.dir/api/version.c.o"
+  "CMakeFiles/fftw3.dir/api/version.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/aligned.c.o"
+  "CMakeFiles/fftw3.dir/dft/aligned.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/batch2d.c.o"
+  "CMakeFiles/fftw3.dir/dft/batch2d.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/bluestein.c.o"
+  "CMakeFiles/fftw3.dir/dft/bluestein.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/buffered.c.o"
+  "CMakeFiles/fftw3.dir/dft/buffered.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/conf.c.o"
+  "CMakeFiles/fftw3.dir/dft/conf.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/ct.c.o"
+  "CMakeFiles/fftw3.dir/dft/ct.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/czt.c.o"
+  "CMakeFiles/fftw3.dir/dft/czt.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/dftw-direct.c.o"
+  "CMakeFiles/fftw3.dir/dft/dftw-direct.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/dftw-directsq.c.o"
+  "CMakeFiles/fftw3.dir/dft/dftw-directsq.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/dftw-generic.c.o"
+  "CMakeFiles/fftw3.dir/dft/dftw-generic.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/dftw-genericbuf.c.o"
+  "CMakeFiles/fftw3.dir/dft/dftw-genericbuf.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/direct.c.o"
+  "CMakeFiles/fftw3.dir/dft/direct.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/generic.c.o"
+  "CMakeFiles/fftw3.dir/dft/generic.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/indirect-transpose.c.o"
+  "CMakeFiles/fftw3.dir/dft/indirect-transpose.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/indirect.c.o"
+  "CMakeFiles/fftw3.dir/dft/indirect.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/kdft-dif.c.o"
+  "CMakeFiles/fftw3.dir/dft/kdft-dif.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/kdft-difsq.c.o"
+  "CMakeFiles/fftw3.dir/dft/kdft-difsq.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/kdft-dit.c.o"
+  "CMakeFiles/fftw3.dir/dft/kdft-dit.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/kdft.c.o"
+  "CMakeFiles/fftw3.dir/dft/kdft.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/layout.c.o"
+  "CMakeFiles/fftw3.dir/dft/layout.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/nop.c.o"
+  "CMakeFiles/fftw3.dir/dft/nop.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/nufft.c.o"
+  "CMakeFiles/fftw3.dir/dft/nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/ooc.c.o"
+  "CMakeFiles/fftw3.dir/dft/ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/plan-nufft.c.o"
+  "CMakeFiles/fftw3.dir/dft/plan-nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/plan-ooc.c.o"
+  "CMakeFiles/fftw3.dir/dft/plan-ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/plan.c.o"
+  "CMakeFiles/fftw3.dir/dft/plan.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/problem-czt.c.o"
+  "CMakeFiles/fftw3.dir/dft/problem-czt.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/problem-nufft.c.o"
+  "CMakeFiles/fftw3.dir/dft/problem-nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/problem-ooc.c.o"
+  "CMakeFiles/fftw3.dir/dft/problem-ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/problem.c.o"
+  "CMakeFiles/fftw3.dir/dft/problem.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/rader.c.o"
+  "CMakeFiles/fftw3.dir/dft/rader.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/rank-geq2.c.o"
+  "CMakeFiles/fftw3.dir/dft/rank-geq2.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/scalar/n.c.o"
+  "CMakeFiles/fftw3.dir/dft/scalar/n.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/scalar/t.c.o"
+  "CMakeFiles/fftw3.dir/dft/scalar/t.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/solve-czt.c.o"
+  "CMakeFiles/fftw3.dir/dft/solve-czt.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/solve-nufft.c.o"
+  "CMakeFiles/fftw3.dir/dft/solve-nufft.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/solve-ooc.c.o"
+  "CMakeFiles/fftw3.dir/dft/solve-ooc.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/solve.c.o"
+  "CMakeFiles/fftw3.dir/dft/solve.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/vrank-geq1.c.o"
+  "CMakeFiles/fftw3.dir/dft/vrank-geq1.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/vsplit.c.o"
+  "CMakeFiles/fftw3.dir/dft/vsplit.c.o.d"
+  "CMakeFiles/fftw3.dir/dft/zero.c.o"
+  "CMakeFiles/fftw3.dir/dft/zero.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/align.c.o"
+  "CMakeFiles/fftw3.dir/kernel/align.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/alloc.c.o"
+  "CMakeFiles/fftw3.dir/kernel/alloc.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/assert.c.o"
+  "CMakeFiles/fftw3.dir/kernel/assert.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/awake.c.o"
+  "CMakeFiles/fftw3.dir/kernel/awake.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/buffered.c.o"
+  "CMakeFiles/fftw3.dir/kernel/buffered.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/cpy1d.c.o"
+  "CMakeFiles/fftw3.dir/kernel/cpy1d.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/cpy2d-pair.c.o"
+  "CMakeFiles/fftw3.dir/kernel/cpy2d-pair.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/cpy2d.c.o"
+  "CMakeFiles/fftw3.dir/kernel/cpy2d.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/ct.c.o"
+  "CMakeFiles/fftw3.dir/kernel/ct.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/debug.c.o"
+  "CMakeFiles/fftw3.dir/kernel/debug.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/extract-reim.c.o"
+  "CMakeFiles/fftw3.dir/kernel/extract-reim.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/hash.c.o"
+  "CMakeFiles/fftw3.dir/kernel/hash.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/iabs.c.o"
+  "CMakeFiles/fftw3.dir/kernel/iabs.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/kalloc.c.o"
+  "CMakeFiles/fftw3.dir/kernel/kalloc.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/md5-1.c.o"
+  "CMakeFiles/fftw3.dir/kernel/md5-1.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/md5.c.o"
+  "CMakeFiles/fftw3.dir/kernel/md5.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/minmax.c.o"
+  "CMakeFiles/fftw3.dir/kernel/minmax.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/ops.c.o"
+  "CMakeFiles/fftw3.dir/kernel/ops.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/pickdim.c.o"
+  "CMakeFiles/fftw3.dir/kernel/pickdim.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/plan.c.o"
+  "CMakeFiles/fftw3.dir/kernel/plan.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/planner.c.o"
+  "CMakeFiles/fftw3.dir/kernel/planner.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/primes.c.o"
+  "CMakeFiles/fftw3.dir/kernel/primes.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/print.c.o"
+  "CMakeFiles/fftw3.dir/kernel/print.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/problem.c.o"
+  "CMakeFiles/fftw3.dir/kernel/problem.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/rader.c.o"
+  "CMakeFiles/fftw3.dir/kernel/rader.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/scan.c.o"
+  "CMakeFiles/fftw3.dir/kernel/scan.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/solver.c.o"
+  "CMakeFiles/fftw3.dir/kernel/solver.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/solvtab.c.o"
+  "CMakeFiles/fftw3.dir/kernel/solvtab.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/storage.c.o"
+  "CMakeFiles/fftw3.dir/kernel/storage.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/stride.c.o"
+  "CMakeFiles/fftw3.dir/kernel/stride.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor1.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor1.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor2.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor2.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor3.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor3.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor4.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor4.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor5.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor5.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor7.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor7.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor8.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor8.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tensor9.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tensor9.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/tile2d.c.o"
+  "CMakeFiles/fftw3.dir/kernel/tile2d.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/timer.c.o"
+  "CMakeFiles/fftw3.dir/kernel/timer.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/transpose.c.o"
+  "CMakeFiles/fftw3.dir/kernel/transpose.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/trig.c.o"
+  "CMakeFiles/fftw3.dir/kernel/trig.c.o.d"
+  "CMakeFiles/fftw3.dir/kernel/twiddle.c.o"
+  "CMakeFiles/fftw3.dir/kernel/twiddle.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/buffered.c.o"
+  "CMakeFiles/fftw3.dir/rdft/buffered.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/buffered2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/buffered2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/conf.c.o"
+  "CMakeFiles/fftw3.dir/rdft/conf.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/ct-hc2c-direct.c.o"
+  "CMakeFiles/fftw3.dir/rdft/ct-hc2c-direct.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/ct-hc2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/ct-hc2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/dft-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/rdft/dft-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/dht-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/rdft/dht-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/dht-rader.c.o"
+  "CMakeFiles/fftw3.dir/rdft/dht-rader.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/direct-r2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/direct-r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/direct-r2r.c.o"
+  "CMakeFiles/fftw3.dir/rdft/direct-r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/direct2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/direct2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/fir.c.o"
+  "CMakeFiles/fftw3.dir/rdft/fir.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/generic.c.o"
+  "CMakeFiles/fftw3.dir/rdft/generic.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/half.c.o"
+  "CMakeFiles/fftw3.dir/rdft/half.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc-direct.c.o"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc-direct.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc-generic.c.o"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc-generic.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc.c.o"
+  "CMakeFiles/fftw3.dir/rdft/hc2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/hcpairs.c.o"
+  "CMakeFiles/fftw3.dir/rdft/hcpairs.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/indirect.c.o"
+  "CMakeFiles/fftw3.dir/rdft/indirect.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/khc2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/khc2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/khc2hc.c.o"
+  "CMakeFiles/fftw3.dir/rdft/khc2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/kr2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/kr2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/kr2r.c.o"
+  "CMakeFiles/fftw3.dir/rdft/kr2r.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/nop.c.o"
+  "CMakeFiles/fftw3.dir/rdft/nop.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/nop2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/nop2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/plan-half.c.o"
+  "CMakeFiles/fftw3.dir/rdft/plan-half.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/plan-stft.c.o"
+  "CMakeFiles/fftw3.dir/rdft/plan-stft.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/plan-stream.c.o"
+  "CMakeFiles/fftw3.dir/rdft/plan-stream.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/plan.c.o"
+  "CMakeFiles/fftw3.dir/rdft/plan.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/plan2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/plan2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/problem-fir.c.o"
+  "CMakeFiles/fftw3.dir/rdft/problem-fir.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/problem-half.c.o"
+  "CMakeFiles/fftw3.dir/rdft/problem-half.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/problem-stft.c.o"
+  "CMakeFiles/fftw3.dir/rdft/problem-stft.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/problem.c.o"
+  "CMakeFiles/fftw3.dir/rdft/problem.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/problem2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/problem2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rank-geq2-rdft2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rank-geq2-rdft2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rank-geq2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rank-geq2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rank0-rdft2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rank0-rdft2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rank0.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rank0.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rdft-dht.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rdft-dht.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-inplace-strides.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-inplace-strides.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-rdft.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-rdft.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-strides.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-strides.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-tensor-max-index.c.o"
+  "CMakeFiles/fftw3.dir/rdft/rdft2-tensor-max-index.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/scalar/hc2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/scalar/hc2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/scalar/hfb.c.o"
+  "CMakeFiles/fftw3.dir/rdft/scalar/hfb.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/scalar/r2c.c.o"
+  "CMakeFiles/fftw3.dir/rdft/scalar/r2c.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/scalar/r2r.c.o"
+  "CMakeFiles/fftw3.dir/rdft/scalar/r2r.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/solve-fir.c.o"
+  "CMakeFiles/fftw3.dir/rdft/solve-fir.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/solve-half.c.o"
+  "CMakeFiles/fftw3.dir/rdft/solve-half.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/solve-stft.c.o"
+  "CMakeFiles/fftw3.dir/rdft/solve-stft.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/solve.c.o"
+  "CMakeFiles/fftw3.dir/rdft/solve.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/solve2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/solve2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/stft.c.o"
+  "CMakeFiles/fftw3.dir/rdft/stft.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/vrank-geq1-rdft2.c.o"
+  "CMakeFiles/fftw3.dir/rdft/vrank-geq1-rdft2.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/vrank-geq1.c.o"
+  "CMakeFiles/fftw3.dir/rdft/vrank-geq1.c.o.d"
+  "CMakeFiles/fftw3.dir/rdft/vrank3-transpose.c.o"
+  "CMakeFiles/fftw3.dir/rdft/vrank3-transpose.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/conf.c.o"
+  "CMakeFiles/fftw3.dir/reodft/conf.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/mdct.c.o"
+  "CMakeFiles/fftw3.dir/reodft/mdct.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/problem-mdct.c.o"
+  "CMakeFiles/fftw3.dir/reodft/problem-mdct.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/redft00e-r2hc-pad.c.o"
+  "CMakeFiles/fftw3.dir/reodft/redft00e-r2hc-pad.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/redft00e-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/reodft/redft00e-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft00e-splitradix.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft00e-splitradix.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft010e-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft010e-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft010e-radix2.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft010e-radix2.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-r2hc-odd.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-r2hc-odd.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-radix2.c.o"
+  "CMakeFiles/fftw3.dir/reodft/reodft11e-radix2.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/rodft00e-r2hc-pad.c.o"
+  "CMakeFiles/fftw3.dir/reodft/rodft00e-r2hc-pad.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/rodft00e-r2hc.c.o"
+  "CMakeFiles/fftw3.dir/reodft/rodft00e-r2hc.c.o.d"
+  "CMakeFiles/fftw3.dir/reodft/solve-mdct.c.o"
+  "CMakeFiles/fftw3.dir/reodft/solve-mdct.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/altivec.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/altivec.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/avx-128-fma.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/avx-128-fma.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/avx.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/avx.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/avx2.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/avx2.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/avx512.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/avx512.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/kcvi.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/kcvi.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/lasx.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/lasx.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/lsx.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/lsx.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/neon.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/neon.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/sse2.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/sse2.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/sve-getwidth.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/sve-getwidth.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/sve.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/sve.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/taint.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/taint.c.o.d"
+  "CMakeFiles/fftw3.dir/simd-support/vsx.c.o"
+  "CMakeFiles/fftw3.dir/simd-support/vsx.c.o.d"
+  "libfftw3.pdb"
+  "libfftw3.so"
+  "libfftw3.so.3"
+  "libfftw3.so.3.6.9"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fftw3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -64,6 +64,12 @@ struct X(plan_s) {
      problem *prb;
      size_t refcount;
      int sign;
+
+     /* with FFTW_ALIGNMENT_VARIANTS: a second plan, valid for arrays
+	of any alignment, used by the new-array execute functions when
+	the arrays are not aligned.  Otherwise 0. */
+     plan *pln_unaligned;
+     problem *prb_unaligned;
 };
 
 /* shorthand */
@@ -104,6 +110,7 @@ void X(configure_planner)(planner *plnr);
 void X(mapflags)(planner *, unsigned);
 
 apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb);
+plan *X(apiplan_select)(const apiplan *p, R *a, R *b, R *c, R *d);
 
 rdft_kind *X(map_r2r_kind)(int rank, const X(r2r_kind) * kind);
 
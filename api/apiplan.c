@@ -19,6 +19,7 @@
  */
 
 #include "api/api.h"
+#include "dft/dft.h"
 
 static planner_hook_t before_planner_hook = 0, after_planner_hook = 0;
 
@@ -83,6 +84,81 @@ static plan *mkplan(planner *plnr, unsigned flags,
      return pln;
 }
 
+#if HAVE_SIMD
+static int aligned1(R *p)
+{
+     return !TAINTOF(p) && X(ialignment_of)(UNTAINT(p)) == 0;
+}
+
+/* for interleaved complex arrays, only the first pointer matters */
+static int aligned2(R *r, R *i)
+{
+     if (UNTAINT(i) == UNTAINT(r) + 1)
+	  return aligned1(r);
+     if (UNTAINT(r) == UNTAINT(i) + 1)
+	  return aligned1(i);
+     return aligned1(r) && aligned1(i);
+}
+
+/* A copy of PRB whose pointers are tainted as with FFTW_UNALIGNED,
+   so that plans for it work for arrays of any alignment.  Set
+   *ALIGNEDP if all the pointers of PRB itself are aligned.  Returns 0
+   for kinds of problems for which this is not supported. */
+static problem *mkproblem_unaligned(const problem *prb, int *alignedp)
+{
+     switch (prb->adt->problem_kind) {
+	 case PROBLEM_DFT: {
+	      const problem_dft *p = (const problem_dft *) prb;
+	      *alignedp = aligned2(p->ri, p->ii) && aligned2(p->ro, p->io);
+	      return X(mkproblem_dft)(p->sz, p->vecsz,
+				      TAINT(p->ri, 1), TAINT(p->ii, 1),
+				      TAINT(p->ro, 1), TAINT(p->io, 1));
+	 }
+	 case PROBLEM_RDFT: {
+	      const problem_rdft *p = (const problem_rdft *) prb;
+	      *alignedp = aligned1(p->I) && aligned1(p->O);
+	      return X(mkproblem_rdft)(p->sz, p->vecsz,
+				       TAINT(p->I, 1), TAINT(p->O, 1),
+				       p->kind);
+	 }
+	 case PROBLEM_RDFT2: {
+	      const problem_rdft2 *p = (const problem_rdft2 *) prb;
+	      /* r1 is derived from r0 by the execute functions */
+	      *alignedp = aligned1(p->r0) && aligned2(p->cr, p->ci);
+	      return X(mkproblem_rdft2)(p->sz, p->vecsz,
+					TAINT(p->r0, 1), TAINT(p->r1, 1),
+					TAINT(p->cr, 1), TAINT(p->ci, 1),
+					p->kind);
+	 }
+	 default:
+	      return 0;
+     }
+}
+#endif
+
+/* the plan that the new-array execute functions should use for the
+   arrays A, B, C, D (unused ones may be 0) */
+plan *X(apiplan_select)(const apiplan *p, R *a, R *b, R *c, R *d)
+{
+     if (p->pln_unaligned
+	 && (X(ialignment_of)(a) | X(ialignment_of)(b)
+	     | X(ialignment_of)(c) | X(ialignment_of)(d)))
+	  return p->pln_unaligned;
+     return p->pln;
+}
+
+static void awake_apiplan(plan *pln)
+{
+     if (sizeof(trigreal) > sizeof(R)) {
+	  /* this is probably faster, and we have enough trigreal
+	     bits to maintain accuracy */
+	  X(plan_awake)(pln, AWAKE_SQRTN_TABLE);
+     } else {
+	  /* more accurate */
+	  X(plan_awake)(pln, AWAKE_SINCOS);
+     }
+}
+
 apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 {
      apiplan *p = 0;
@@ -93,12 +169,27 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
                                          FFTW_PATIENT, FFTW_EXHAUSTIVE};
      int pat, pat_max;
      double pcost = 0;
+     problem *uprb = 0;
 
      if (before_planner_hook)
           before_planner_hook();
 
      plnr = X(the_planner)();
 
+#if HAVE_SIMD
+     if ((flags & FFTW_ALIGNMENT_VARIANTS) && !(flags & FFTW_UNALIGNED)) {
+	  int aligned;
+	  uprb = mkproblem_unaligned(prb, &aligned);
+	  if (uprb && !aligned) {
+	       /* the arrays at hand are not aligned, so the aligned
+		  variant would never be used: plan only the other one */
+	       X(problem_destroy)(prb);
+	       prb = uprb;
+	       uprb = 0;
+	  }
+     }
+#endif
+
      if (flags & FFTW_WISDOM_ONLY) {
 	  /* Special mode that returns a plan only if wisdom is present,
 	     and returns 0 otherwise.  This is now documented in the manual,
@@ -142,6 +233,8 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 	  p->prb = prb;
 	  p->refcount = 1u;
 	  p->sign = sign; /* cache for execute_dft */
+	  p->pln_unaligned = 0;
+	  p->prb_unaligned = 0;
 
 	  /* re-create plan from wisdom, adding blessing */
 	  p->pln = mkplan(plnr, flags_used_for_planning, prb, BLESSING);
@@ -149,21 +242,29 @@ apiplan *X(mkapiplan)(int sign, unsigned flags, problem *prb)
 	  /* record pcost from most recent measurement for use in X(cost) */
 	  p->pln->pcost = pcost;
 
-	  if (sizeof(trigreal) > sizeof(R)) {
-	       /* this is probably faster, and we have enough trigreal
-		  bits to maintain accuracy */
-	       X(plan_awake)(p->pln, AWAKE_SQRTN_TABLE);
-	  } else {
-	       /* more accurate */
-	       X(plan_awake)(p->pln, AWAKE_SINCOS);
-	  }
+	  awake_apiplan(p->pln);
 
 	  /* we don't use pln for p->pln, above, since by re-creating the
 	     plan we might use more patient wisdom from a timed-out mkplan */
 	  X(plan_destroy_internal)(pln);
+
+	  if (uprb) {
+	       /* plan the variant with the same patience; if this
+		  fails, the apiplan simply has no variant */
+	       p->pln_unaligned =
+		    mkplan(plnr, flags_used_for_planning, uprb, BLESSING);
+	       if (p->pln_unaligned) {
+		    awake_apiplan(p->pln_unaligned);
+		    p->prb_unaligned = uprb;
+		    uprb = 0;
+	       }
+	  }
      } else
 	  X(problem_destroy)(prb);
 
+     if (uprb)
+	  X(problem_destroy)(uprb);
+
      /* discard all information not necessary to reconstruct the plan */
      plnr->adt->forget(plnr, FORGET_ACCURSED);
 
@@ -201,6 +302,11 @@ void X(destroy_plan)(X(plan) p)
                X(plan_awake)(p->pln, SLEEPY);
                X(plan_destroy_internal)(p->pln);
                X(problem_destroy)(p->prb);
+               if (p->pln_unaligned) {
+                    X(plan_awake)(p->pln_unaligned, SLEEPY);
+                    X(plan_destroy_internal)(p->pln_unaligned);
+                    X(problem_destroy)(p->prb_unaligned);
+               }
                X(ifree)(p);
           }
 
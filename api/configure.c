@@ -23,9 +23,24 @@
 #include "rdft/rdft.h"
 #include "reodft/reodft.h"
 
+/* Each table is registered the first time the planner sees a problem
+   of one of the listed kinds, so that, say, a program computing only
+   complex DFTs never pays for the real-data codelets. */
 void X(configure_planner)(planner *plnr)
 {
-     X(dft_conf_standard)(plnr);
-     X(rdft_conf_standard)(plnr);
-     X(reodft_conf_standard)(plnr);
+     X(planner_defer)(plnr, X(dft_conf_standard),
+		      PROBLEM_KIND_BIT(PROBLEM_DFT)
+		      | PROBLEM_KIND_BIT(PROBLEM_DFT_OOC)
+		      | PROBLEM_KIND_BIT(PROBLEM_NUFFT)
+		      | PROBLEM_KIND_BIT(PROBLEM_CZT));
+     X(planner_defer)(plnr, X(rdft_conf_dft), PROBLEM_KIND_BIT(PROBLEM_DFT));
+     X(planner_defer)(plnr, X(rdft_conf_standard),
+		      PROBLEM_KIND_BIT(PROBLEM_RDFT)
+		      | PROBLEM_KIND_BIT(PROBLEM_RDFT2)
+		      | PROBLEM_KIND_BIT(PROBLEM_STFT)
+		      | PROBLEM_KIND_BIT(PROBLEM_FIR)
+		      | PROBLEM_KIND_BIT(PROBLEM_HALF));
+     X(planner_defer)(plnr, X(reodft_conf_standard),
+		      PROBLEM_KIND_BIT(PROBLEM_RDFT)
+		      | PROBLEM_KIND_BIT(PROBLEM_MDCT));
 }
@@ -24,7 +24,8 @@
 /* guru interface: requires care in alignment, r - i, etcetera. */
 void X(execute_dft_c2r)(const X(plan) p, C *in, R *out)
 {
-     plan_rdft2 *pln = (plan_rdft2 *) p->pln;
+     plan_rdft2 *pln =
+	  (plan_rdft2 *) X(apiplan_select)(p, in[0], out, 0, 0);
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
      pln->apply((plan *) pln, out, out + (prb->r1 - prb->r0), in[0], in[0]+1);
 }
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "dft/dft.h"
+
+/* new-file execute for plans created by X(plan_dft_ooc).  Returns 1
+   on success and 0 if a read or write failed, or the input file was
+   too short, in which case the output is incomplete. */
+int X(execute_dft_ooc)(const X(plan) p, int ifd, ptrdiff_t ioffset,
+		       int ofd, ptrdiff_t ooffset)
+{
+     plan_dft_ooc *pln = (plan_dft_ooc *) p->pln;
+     return pln->apply((plan *) pln, ifd, ioffset, ofd, ooffset);
+}
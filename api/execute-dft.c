@@ -24,7 +24,8 @@
 /* guru interface: requires care in alignment etcetera. */
 void X(execute_dft)(const X(plan) p, C *in, C *out)
 {
-     plan_dft *pln = (plan_dft *) p->pln;
+     plan_dft *pln =
+	  (plan_dft *) X(apiplan_select)(p, in[0], out[0], 0, 0);
      if (p->sign == FFT_SIGN)
 	  pln->apply((plan *) pln, in[0], in[0]+1, out[0], out[0]+1);
      else
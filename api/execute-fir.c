@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "rdft/rdft.h"
+
+/* new-array execute for plans created by X(plan_fir), continuing the
+   stream whose state is STATE, or the plan's own if STATE is NULL */
+void X(execute_fir)(const X(plan) p, R *state, R *in, R *out)
+{
+     plan_stream *pln = (plan_stream *) p->pln;
+     pln->apply((plan *) pln, state ? state : pln->state, in, out);
+}
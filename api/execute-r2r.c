@@ -24,6 +24,7 @@
 /* guru interface: requires care in alignment, etcetera. */
 void X(execute_r2r)(const X(plan) p, R *in, R *out)
 {
-     plan_rdft *pln = (plan_rdft *) p->pln;
+     plan_rdft *pln =
+	  (plan_rdft *) X(apiplan_select)(p, in, out, 0, 0);
      pln->apply((plan *) pln, in, out);
 }
@@ -24,7 +24,8 @@
 /* guru interface: requires care in alignment, r - i, etcetera. */
 void X(execute_split_dft_c2r)(const X(plan) p, R *ri, R *ii, R *out)
 {
-     plan_rdft2 *pln = (plan_rdft2 *) p->pln;
+     plan_rdft2 *pln =
+	  (plan_rdft2 *) X(apiplan_select)(p, ri, ii, out, 0);
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
      pln->apply((plan *) pln, out, out + (prb->r1 - prb->r0), ri, ii);
 }
@@ -24,7 +24,8 @@
 /* guru interface: requires care in alignment, r - i, etcetera. */
 void X(execute_split_dft_r2c)(const X(plan) p, R *in, R *ro, R *io)
 {
-     plan_rdft2 *pln = (plan_rdft2 *) p->pln;
+     plan_rdft2 *pln =
+	  (plan_rdft2 *) X(apiplan_select)(p, in, ro, io, 0);
      problem_rdft2 *prb = (problem_rdft2 *) p->prb;
      pln->apply((plan *) pln, in, in + (prb->r1 - prb->r0), ro, io);
 }
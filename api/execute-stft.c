@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "rdft/rdft.h"
+
+/* new-array execute for plans created by X(plan_stft), with the first
+   frame starting at index POS of the ring buffer */
+void X(execute_stft)(const X(plan) p, R *in, int pos, C *out)
+{
+     plan_stft *pln = (plan_stft *) p->pln;
+     R *ro, *io;
+     EXTRACT_REIM(FFT_SIGN, out, &ro, &io);
+     pln->apply((plan *) pln, in, pos, ro, io);
+}
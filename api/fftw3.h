@@ -99,6 +99,10 @@ enum fftw_r2r_kind_do_not_use_me {
      FFTW_RODFT00=7, FFTW_RODFT01=8, FFTW_RODFT10=9, FFTW_RODFT11=10
 };
 
+enum fftw_storage_do_not_use_me {
+     FFTW_STORAGE_NATIVE=0, FFTW_STORAGE_FP16=1, FFTW_STORAGE_BF16=2
+};
+
 struct fftw_iodim_do_not_use_me {
      int n;                     /* dimension size */
      int is;			/* input stride */
@@ -124,6 +128,13 @@ typedef int (FFTW_CDECL *fftw_read_char_func_do_not_use_me)(void *);
   C: complex data type
 */
 
+/*
+  X(execute_dft_ooc) returns 1 on success, and 0 if a read or write
+  failed or the input file ended early, in which case the output is
+  incomplete.  X(execute) on an out-of-core plan cannot report such
+  errors.
+*/
+
 #define FFTW_DEFINE_API(X, R, C)                                        \
                                                                         \
 FFTW_DEFINE_COMPLEX(R, C);                                              \
@@ -134,6 +145,7 @@ typedef struct fftw_iodim_do_not_use_me X(iodim);                       \
 typedef struct fftw_iodim64_do_not_use_me X(iodim64);                   \
                                                                         \
 typedef enum fftw_r2r_kind_do_not_use_me X(r2r_kind);                   \
+typedef enum fftw_storage_do_not_use_me X(storage);                     \
                                                                         \
 typedef fftw_write_char_func_do_not_use_me X(write_char_func);          \
 typedef fftw_read_char_func_do_not_use_me X(read_char_func);            \
@@ -200,6 +212,89 @@ FFTW_CDECL X(execute_split_dft)(const X(plan) p, R *ri, R *ii,          \
                                       R *ro, R *io);                    \
                                                                         \
 FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_dft_ooc)(int rank, const ptrdiff_t *n,                \
+                           int ifd, ptrdiff_t ioffset,                  \
+                           int ofd, ptrdiff_t ooffset,                  \
+                           int sign, unsigned flags);                   \
+                                                                        \
+FFTW_EXTERN int                                                         \
+FFTW_CDECL X(execute_dft_ooc)(const X(plan) p,                          \
+                              int ifd, ptrdiff_t ioffset,               \
+                              int ofd, ptrdiff_t ooffset);              \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_nufft)(int type, int rank, const int *n, int m,       \
+                         R *x, C *c, C *f, int sign, double eps,        \
+                         unsigned flags);                               \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_nufft)(const X(plan) p, R *x, C *c, C *f);         \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_czt_1d)(int n, int m, C *in, C *out,                  \
+                          double f0, double df, int sign,               \
+                          unsigned flags);                              \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_stft)(int n, int hop, int nframes, int ring,          \
+                        R *in, const R *window, C *out,                 \
+                        unsigned flags);                                \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_stft)(const X(plan) p, R *in, int pos, C *out);    \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_fir)(int ntaps, const R *h, int block,                \
+                       R *in, R *out, unsigned flags);                  \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_fir)(const X(plan) p, R *state, R *in, R *out);    \
+                                                                        \
+FFTW_EXTERN R *                                                         \
+FFTW_CDECL X(alloc_stream_state)(const X(plan) p);                      \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(reset_stream_state)(const X(plan) p, R *state);            \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_mdct)(int n, R *in, R *out, const R *window,          \
+                        unsigned flags);                                \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_imdct)(int n, R *in, R *out, const R *window,         \
+                         int overlap_add, unsigned flags);              \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_mdct)(const X(plan) p, R *state, R *in, R *out);   \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_many_dft_half)(int n, int howmany,                    \
+                                 void *in, int istride, int idist,      \
+                                 X(storage) itype,                      \
+                                 void *out, int ostride, int odist,     \
+                                 X(storage) otype,                      \
+                                 int sign, unsigned flags);             \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_many_dft_r2c_half)(int n, int howmany,                \
+                                     void *in, int istride, int idist,  \
+                                     X(storage) itype,                  \
+                                     void *out, int ostride, int odist, \
+                                     X(storage) otype,                  \
+                                     unsigned flags);                   \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
+FFTW_CDECL X(plan_many_dft_c2r_half)(int n, int howmany,                \
+                                     void *in, int istride, int idist,  \
+                                     X(storage) itype,                  \
+                                     void *out, int ostride, int odist, \
+                                     X(storage) otype,                  \
+                                     unsigned flags);                   \
+                                                                        \
+FFTW_EXTERN void                                                        \
+FFTW_CDECL X(execute_half)(const X(plan) p, void *in, void *out);       \
+                                                                        \
+FFTW_EXTERN X(plan)                                                     \
 FFTW_CDECL X(plan_many_dft_r2c)(int rank, const int *n,                 \
                                 int howmany,                            \
                                 R *in, const int *inembed,              \
@@ -501,6 +596,7 @@ FFTW_DEFINE_API(FFTW_MANGLE_QUAD, __float128, fftwq_complex)
 #define FFTW_PATIENT (1U << 5) /* IMPATIENT is default */
 #define FFTW_ESTIMATE (1U << 6)
 #define FFTW_WISDOM_ONLY (1U << 21)
+#define FFTW_ALIGNMENT_VARIANTS (1U << 22)
 
 /* undocumented beyond-guru flags */
 #define FFTW_ESTIMATE_PATIENT (1U << 7)
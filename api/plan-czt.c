@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "dft/dft.h"
+
+/* chirp-z transform of the N complex numbers IN, evaluated at the M
+   frequencies F0 + k DF (in cycles per sample), k = 0 ... M-1:
+
+   OUT[k] = sum_{j<N} IN[j] exp(SIGN 2 pi i j (F0 + k DF))
+
+   The plan can be executed on new arrays with X(execute_dft). */
+X(plan) X(plan_czt_1d)(int n, int m, C *in, C *out, 
+		       double f0, double df, int sign, unsigned flags)
+{
+     R *ri, *ii, *ro, *io;
+
+     if (n <= 0 || m <= 0) return 0;
+
+     EXTRACT_REIM(sign, in, &ri, &ii);
+     EXTRACT_REIM(sign, out, &ro, &io);
+
+     return X(mkapiplan)(
+	  sign, flags,
+	  X(mkproblem_czt)(n, m, 2, 2,
+			   TAINT_UNALIGNED(ri, flags),
+			   TAINT_UNALIGNED(ii, flags),
+			   TAINT_UNALIGNED(ro, flags),
+			   TAINT_UNALIGNED(io, flags),
+			   f0, df));
+}
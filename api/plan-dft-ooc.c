@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "dft/dft.h"
+
+/* out-of-core transform of a row-major array of N[0] x ... x N[RANK-1]
+   complex numbers stored at byte offset IOFFSET of the file IFD,
+   with output at byte offset OOFFSET of OFD.  Rank-1 transforms
+   require FFTW_DESTROY_INPUT and distinct input and output. */
+X(plan) X(plan_dft_ooc)(int rank, const ptrdiff_t *n,
+			int ifd, ptrdiff_t ioffset,
+			int ofd, ptrdiff_t ooffset,
+			int sign, unsigned flags)
+{
+     int i;
+
+     if (rank < 1 || !FINITE_RNK(rank)) return 0;
+     for (i = 0; i < rank; ++i)
+	  if (n[i] <= 0) return 0;
+
+     /* the planner must not time the whole transform, but believe
+	the cost that the solver extrapolates from one block */
+     return X(mkapiplan)(sign, flags | FFTW_BELIEVE_PCOST,
+			 X(mkproblem_dft_ooc)(rank, n, ifd, ioffset,
+					      ofd, ooffset, sign));
+}
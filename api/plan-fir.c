@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "rdft/rdft.h"
+
+/* streaming FIR filter with the NTAPS taps H.  Each execution reads
+   BLOCK samples from IN and writes the next BLOCK samples of the
+   filtered stream to OUT, which may equal IN; the filter starts from
+   a silent history.  The taps are copied into the plan.  X(execute)
+   continues the stream held by the plan, and must not be called
+   concurrently; X(execute_fir) with states from X(alloc_stream_state)
+   filters independent streams, from several threads if need be. */
+X(plan) X(plan_fir)(int ntaps, const R *h, int block,
+		    R *in, R *out, unsigned flags)
+{
+     if (ntaps <= 0 || block <= 0) return 0;
+
+     return X(mkapiplan)(
+	  0, flags,
+	  X(mkproblem_fir)(ntaps, h, block, 
+			   TAINT_UNALIGNED(in, flags),
+			   TAINT_UNALIGNED(out, flags)));
+}
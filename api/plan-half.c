@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+
+/* Batched one-dimensional transforms of HOWMANY arrays of size N
+   stored in the formats ITYPE and OTYPE.  The transforms are computed
+   in R, and the conversions to and from 16-bit storage happen while
+   the data are copied into the planner's buffers, so that the arrays
+   are traversed only once, in 16 bits.  Strides and distances are in
+   units of elements, as for X(plan_many_dft), and complex arrays are
+   interleaved pairs of the storage type.  The plans can be executed
+   on new arrays with X(execute_half). */
+
+static int storage_ok(X(storage) t)
+{
+     return (t == FFTW_STORAGE_NATIVE
+	     || t == FFTW_STORAGE_FP16
+	     || t == FFTW_STORAGE_BF16);
+}
+
+static X(plan) mkplan(int kind, int n, int howmany,
+		      void *in, int istride, int idist, X(storage) itype,
+		      void *out, int ostride, int odist, X(storage) otype,
+		      int sign, unsigned flags)
+{
+     /* complex elements are pairs of numbers */
+     INT mi = (kind == HALF_R2C) ? 1 : 2;
+     INT mo = (kind == HALF_C2R) ? 1 : 2;
+
+     if (n <= 0 || howmany <= 0) return 0;
+     if (!storage_ok(itype) || !storage_ok(otype)) return 0;
+
+     return X(mkapiplan)(
+	  sign, flags,
+	  X(mkproblem_half)(kind, n, howmany,
+			    in, mi * istride, mi * idist, 
+			    (enum storage_fmt) itype,
+			    out, mo * ostride, mo * odist, 
+			    (enum storage_fmt) otype,
+			    sign));
+}
+
+X(plan) X(plan_many_dft_half)(int n, int howmany,
+			      void *in, int istride, int idist,
+			      X(storage) itype,
+			      void *out, int ostride, int odist,
+			      X(storage) otype,
+			      int sign, unsigned flags)
+{
+     return mkplan(HALF_DFT, n, howmany, in, istride, idist, itype,
+		   out, ostride, odist, otype, sign, flags);
+}
+
+X(plan) X(plan_many_dft_r2c_half)(int n, int howmany,
+				  void *in, int istride, int idist,
+				  X(storage) itype,
+				  void *out, int ostride, int odist,
+				  X(storage) otype,
+				  unsigned flags)
+{
+     return mkplan(HALF_R2C, n, howmany, in, istride, idist, itype,
+		   out, ostride, odist, otype, 0, flags);
+}
+
+X(plan) X(plan_many_dft_c2r_half)(int n, int howmany,
+				  void *in, int istride, int idist,
+				  X(storage) itype,
+				  void *out, int ostride, int odist,
+				  X(storage) otype,
+				  unsigned flags)
+{
+     return mkplan(HALF_C2R, n, howmany, in, istride, idist, itype,
+		   out, ostride, odist, otype, 0, flags);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "reodft/reodft.h"
+
+/* MDCT of the 2N inputs IN, times WINDOW[0..2N-1] if WINDOW is not
+   NULL, into the N outputs OUT:
+
+   OUT[k] = sum_{j<2N} IN[j] WINDOW[j] cos(pi/N (j + 1/2 + N/2) (k + 1/2))
+
+   N must be even.  The window is copied into the plan. */
+X(plan) X(plan_mdct)(int n, R *in, R *out, const R *window, 
+		     unsigned flags)
+{
+     if (n <= 0 || n % 2) return 0;
+
+     return X(mkapiplan)(
+	  0, flags,
+	  X(mkproblem_mdct)(n, 0, 0, 
+			    TAINT_UNALIGNED(in, flags),
+			    TAINT_UNALIGNED(out, flags), window));
+}
+
+/* IMDCT (unnormalized transpose of the MDCT) of the N inputs IN, times
+   WINDOW[0..2N-1] if WINDOW is not NULL.  If OVERLAP_ADD is zero, the
+   2N outputs are stored in OUT.  Otherwise, the first N outputs plus
+   the last N outputs of the previous execution (zero initially) are
+   stored in OUT, which yields N/2 times the original signal for a
+   Princen-Bradley window.  X(execute) adds the tail held by the plan,
+   and must not be called concurrently; X(execute_mdct) takes the N
+   reals of the tail from the caller instead. */
+X(plan) X(plan_imdct)(int n, R *in, R *out, const R *window, 
+		      int overlap_add, unsigned flags)
+{
+     if (n <= 0 || n % 2) return 0;
+
+     return X(mkapiplan)(
+	  0, flags,
+	  X(mkproblem_mdct)(n, 1, overlap_add != 0,
+			    TAINT_UNALIGNED(in, flags),
+			    TAINT_UNALIGNED(out, flags), window));
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "dft/dft.h"
+
+/* non-uniform DFT of type 1 (TYPE = 1) or 2 between the M points with
+   coordinates X[j * RANK + i] and the modes -N[i]/2 <= k[i] < N[i]/2,
+   stored row-major in F.  The result is accurate to a relative
+   tolerance of about EPS. */
+X(plan) X(plan_nufft)(int type, int rank, const int *n, int m,
+		      R *x, C *c, C *f, int sign, double eps,
+		      unsigned flags)
+{
+     INT N[3];
+     int i;
+
+     if (type != 1 && type != 2) return 0;
+     if (rank < 1 || rank > 3 || m < 0) return 0;
+     for (i = 0; i < rank; ++i) {
+	  if (n[i] <= 0) return 0;
+	  N[i] = n[i];
+     }
+
+     return X(mkapiplan)(sign, flags,
+			 X(mkproblem_nufft)(type, rank, N, m, x,
+					    c[0], f[0], sign, eps));
+}
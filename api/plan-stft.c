@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "rdft/rdft.h"
+
+/* short-time Fourier transform of the ring buffer IN of RING samples:
+   frame f is made of the N samples starting at index (pos + f HOP)
+   mod RING, times WINDOW[0..N-1] (if WINDOW is not NULL), and its
+   N/2+1 complex outputs are stored at OUT + f (N/2+1).  The window is
+   copied into the plan.  X(execute) uses pos = 0; X(execute_stft)
+   takes the position of the first frame. */
+X(plan) X(plan_stft)(int n, int hop, int nframes, int ring,
+		     R *in, const R *window, C *out, unsigned flags)
+{
+     R *ro, *io;
+
+     if (n <= 0 || hop <= 0 || nframes <= 0 || ring < n) return 0;
+
+     EXTRACT_REIM(FFT_SIGN, out, &ro, &io);
+
+     return X(mkapiplan)(
+	  0, flags,
+	  X(mkproblem_stft)(n, hop, nframes, ring, 
+			    TAINT_UNALIGNED(in, flags), 0, window,
+			    TAINT_UNALIGNED(ro, flags),
+			    TAINT_UNALIGNED(io, flags),
+			    2, 2 * (n / 2 + 1)));
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "api/api.h"
+#include "rdft/rdft.h"
+
+/* the state of a new stream for the FIR or overlap-add IMDCT plan P,
+   which starts with silence, to be freed with X(free).  Its contents
+   are private to FIR plans; for the IMDCT, they are the N reals of
+   the tail to be added to the next output. */
+R *X(alloc_stream_state)(const X(plan) p)
+{
+     plan_stream *pln = (plan_stream *) p->pln;
+     R *state = X(alloc_real)(pln->nstate > 0 ? (size_t) pln->nstate : 1);
+     X(reset_stream_state)(p, state);
+     return state;
+}
+
+/* restart the stream whose state is STATE, or that of the plan itself
+   if STATE is NULL, from silence */
+void X(reset_stream_state)(const X(plan) p, R *state)
+{
+     plan_stream *pln = (plan_stream *) p->pln;
+     INT i;
+
+     if (!state) state = pln->state;
+     if (state)
+	  for (i = 0; i < pln->nstate; ++i)
+	       state[i] = K(0.0);
+}
@@ -97,4 +97,8 @@ const char X(version)[] = PACKAGE "-" PACKAGE_VERSION
    "-generic_simd256"
 #endif
 
+#if defined(HAVE_GENERIC_SIMD512)
+   "-generic_simd512"
+#endif
+
 ;
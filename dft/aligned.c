@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Staging through an aligned buffer, for problems whose arrays are
+   not aligned (or not known to be aligned, as with FFTW_UNALIGNED).
+   The SIMD codelets require aligned arrays, so without this solver
+   such problems fall back to scalar codelets.  Here we copy the input
+   into an aligned buffer, transform it in place there with whatever
+   plan the planner likes best, and copy the result out, NBUF
+   transforms at a time as in dft-buffered.  The copies are rank-0
+   plans on the (tainted) user arrays, so the plan remains valid for
+   any alignment at execution time. */
+
+#include "dft/dft.h"
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+
+     plan *cldcpyin, *cld, *cldcpyout, *cldrest;
+     INT n, vl, nbuf, bufdist;
+     INT ivs_by_nbuf, ovs_by_nbuf;
+     INT roffset, ioffset;
+} P;
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     R *bufs = (R *) MALLOC(sizeof(R) * ego->nbuf * ego->bufdist * 2,
+			    BUFFERS);
+     R *br = bufs + ego->roffset, *bi = bufs + ego->ioffset;
+     plan_dft *cldcpyin = (plan_dft *) ego->cldcpyin;
+     plan_dft *cld = (plan_dft *) ego->cld;
+     plan_dft *cldcpyout = (plan_dft *) ego->cldcpyout;
+     plan_dft *cldrest;
+     INT i, nbuf = ego->nbuf, vl = ego->vl;
+     INT ivs_by_nbuf = ego->ivs_by_nbuf, ovs_by_nbuf = ego->ovs_by_nbuf;
+
+     for (i = nbuf; i <= vl; i += nbuf) {
+	  cldcpyin->apply((plan *) cldcpyin, ri, ii, br, bi);
+	  ri += ivs_by_nbuf; ii += ivs_by_nbuf;
+
+	  cld->apply((plan *) cld, br, bi, br, bi);
+
+	  cldcpyout->apply((plan *) cldcpyout, br, bi, ro, io);
+	  ro += ovs_by_nbuf; io += ovs_by_nbuf;
+     }
+
+     X(ifree)(bufs);
+
+     /* do the remaining transforms, if any */
+     cldrest = (plan_dft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, ri, ii, ro, io);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cldcpyin, wakefulness);
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldcpyout, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cldcpyout);
+     X(plan_destroy_internal)(ego->cld);
+     X(plan_destroy_internal)(ego->cldcpyin);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-aligned-%D%v/%D%(%p%)%(%p%)%(%p%)%(%p%))",
+              ego->n, ego->nbuf, ego->vl,
+              ego->cldcpyin, ego->cld, ego->cldcpyout, ego->cldrest);
+}
+
+#ifdef MIN_ALIGNMENT
+static int misaligned1(const R *p)
+{
+     return (TAINTOF(p) != 0
+	     || ((uintptr_t) UNTAINT(p)) % MIN_ALIGNMENT != 0);
+}
+
+/* for interleaved arrays, only the address of the first complex
+   number matters */
+static int misaligned(const R *r, const R *i)
+{
+     if (UNTAINT(i) == UNTAINT(r) + 1)
+	  return misaligned1(r);
+     if (UNTAINT(r) == UNTAINT(i) + 1)
+	  return misaligned1(i);
+     return misaligned1(r) || misaligned1(i);
+}
+#endif
+
+static int applicable(const problem *p_, const planner *plnr)
+{
+#ifdef MIN_ALIGNMENT
+     const problem_dft *p = (const problem_dft *) p_;
+     INT n, vl, ivs, ovs;
+
+     if (NO_SIMDP(plnr) || NO_BUFFERINGP(plnr))
+	  return 0;
+
+     if (!(1
+	   && p->sz->rnk == 1
+	   && p->vecsz->rnk <= 1
+	   && (misaligned(p->ri, p->ii) || misaligned(p->ro, p->io))))
+	  return 0;
+
+     n = p->sz->dims[0].n;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+
+     if (CONSERVE_MEMORYP(plnr) && X(toobig)(n))
+	  return 0;
+
+     /* in place, a batch must not overwrite the input of later
+	batches, unless everything fits in the buffer */
+     if (p->ri == p->ro
+	 && !X(tensor_inplace_strides2)(p->sz, p->vecsz)
+	 && X(nbuf)(n, vl, 0) < vl)
+	  return 0;
+
+     return 1;
+#else
+     /* without SIMD there is nothing to gain */
+     UNUSED(p_); UNUSED(plnr);
+     return 0;
+#endif
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     P *pln;
+     plan *cldcpyin = (plan *) 0, *cld = (plan *) 0, *cldcpyout = (plan *) 0;
+     plan *cldrest = (plan *) 0;
+     const problem_dft *p = (const problem_dft *) p_;
+     R *bufs = (R *) 0, *br, *bi;
+     INT n, vl, ivs, ovs, nbuf, bufdist, roffset, ioffset;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     UNUSED(ego);
+     if (!applicable(p_, plnr))
+          goto nada;
+
+     n = p->sz->dims[0].n;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+
+     nbuf = X(nbuf)(n, vl, 0);
+     bufdist = X(bufdist)(n, vl);
+     A(nbuf > 0);
+
+     /* keep real and imaginary parts in the same order, as in
+	dft-buffered */
+     roffset = (p->ri - p->ii > 0) ? (INT)1 : (INT)0;
+     ioffset = 1 - roffset;
+
+     /* initial allocation for the purpose of planning */
+     bufs = (R *) MALLOC(sizeof(R) * nbuf * bufdist * 2, BUFFERS);
+     br = bufs + roffset; bi = bufs + ioffset;
+
+     /* the buffer holds nbuf interleaved arrays of size n */
+     cldcpyin = X(mkplan_d)(plnr,
+			    X(mkproblem_dft_d)(
+				 X(mktensor_0d)(),
+				 X(mktensor_2d)(nbuf, ivs, bufdist * 2,
+						n, p->sz->dims[0].is, 2),
+				 TAINT(p->ri, ivs * nbuf),
+				 TAINT(p->ii, ivs * nbuf),
+				 br, bi));
+     if (!cldcpyin)
+	  goto nada;
+
+     cld = X(mkplan_d)(plnr,
+		       X(mkproblem_dft_d)(
+			    X(mktensor_1d)(n, 2, 2),
+			    X(mktensor_1d)(nbuf, bufdist * 2, bufdist * 2),
+			    br, bi, br, bi));
+     if (!cld)
+	  goto nada;
+
+     cldcpyout = X(mkplan_d)(plnr,
+			     X(mkproblem_dft_d)(
+				  X(mktensor_0d)(),
+				  X(mktensor_2d)(nbuf, bufdist * 2, ovs,
+						 n, 2, p->sz->dims[0].os),
+				  br, bi,
+				  TAINT(p->ro, ovs * nbuf),
+				  TAINT(p->io, ovs * nbuf)));
+     if (!cldcpyout)
+	  goto nada;
+
+     /* deallocate buffer, let apply() allocate it for real */
+     X(ifree)(bufs);
+     bufs = 0;
+
+     /* plan the leftover transforms (cldrest): */
+     {
+	  INT id = ivs * (nbuf * (vl / nbuf));
+	  INT od = ovs * (nbuf * (vl / nbuf));
+	  cldrest = X(mkplan_d)(plnr,
+				X(mkproblem_dft_d)(
+				     X(tensor_copy)(p->sz),
+				     X(mktensor_1d)(vl % nbuf, ivs, ovs),
+				     p->ri + id, p->ii + id,
+				     p->ro + od, p->io + od));
+     }
+     if (!cldrest)
+	  goto nada;
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+     pln->cldcpyin = cldcpyin;
+     pln->cld = cld;
+     pln->cldcpyout = cldcpyout;
+     pln->cldrest = cldrest;
+     pln->n = n;
+     pln->vl = vl;
+     pln->nbuf = nbuf;
+     pln->bufdist = bufdist;
+     pln->ivs_by_nbuf = ivs * nbuf;
+     pln->ovs_by_nbuf = ovs * nbuf;
+     pln->roffset = roffset;
+     pln->ioffset = ioffset;
+
+     {
+	  opcnt t, u;
+	  X(ops_add)(&cldcpyin->ops, &cld->ops, &t);
+	  X(ops_add)(&t, &cldcpyout->ops, &u);
+	  X(ops_madd)(vl / nbuf, &u, &cldrest->ops, &pln->super.super.ops);
+     }
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(bufs);
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cldcpyout);
+     X(plan_destroy_internal)(cld);
+     X(plan_destroy_internal)(cldcpyin);
+     return (plan *) 0;
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(dft_aligned_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
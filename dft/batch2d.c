@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Batches of small two-dimensional DFTs, such as the 8x8 and 16x16
+   blocks of image codecs, given as a rank-2 problem with a long
+   vector loop.
+
+   Row-column plans for such a problem sweep the whole batch once per
+   dimension, so for large batches every block is brought into cache
+   twice.  This solver instead copies NB blocks at a time into a
+   buffer, laid out with the block index varying fastest (one block
+   per "lane", as in struct-of-arrays form), transforms the buffer in
+   place with a child plan whose vector stride is one complex number,
+   and copies the result out.  With that layout the SIMD codelets
+   compute one block per SIMD lane, and each batch stays in cache for
+   both dimensions. */
+
+#include "dft/dft.h"
+
+typedef struct {
+     solver super;
+     INT nb;
+} S;
+
+/* largest block handled, in complex elements */
+#define MAXBLK 256
+
+typedef struct {
+     plan_dft super;
+
+     plan *cld, *cldrest;
+     INT n0, n1, is0, is1, os0, os1;
+     INT nb, vl, ivs, ovs;
+     int roffset, ioffset;
+} P;
+
+static void gather(const P *ego, const R *ri, const R *ii, R *buf)
+{
+     INT j0, j1, l;
+     INT n0 = ego->n0, n1 = ego->n1, nb = ego->nb, ivs = ego->ivs;
+     INT is0 = ego->is0, is1 = ego->is1;
+     R *br = buf + ego->roffset, *bi = buf + ego->ioffset;
+
+     for (j0 = 0; j0 < n0; ++j0)
+	  for (j1 = 0; j1 < n1; ++j1) {
+	       const R *xr = ri + j0 * is0 + j1 * is1;
+	       const R *xi = ii + j0 * is0 + j1 * is1;
+	       INT e = 2 * nb * (j0 * n1 + j1);
+	       for (l = 0; l < nb; ++l) {
+		    br[e + 2 * l] = xr[l * ivs];
+		    bi[e + 2 * l] = xi[l * ivs];
+	       }
+	  }
+}
+
+static void scatter(const P *ego, const R *buf, R *ro, R *io)
+{
+     INT j0, j1, l;
+     INT n0 = ego->n0, n1 = ego->n1, nb = ego->nb, ovs = ego->ovs;
+     INT os0 = ego->os0, os1 = ego->os1;
+     const R *br = buf + ego->roffset, *bi = buf + ego->ioffset;
+
+     for (j0 = 0; j0 < n0; ++j0)
+	  for (j1 = 0; j1 < n1; ++j1) {
+	       R *yr = ro + j0 * os0 + j1 * os1;
+	       R *yi = io + j0 * os0 + j1 * os1;
+	       INT e = 2 * nb * (j0 * n1 + j1);
+	       for (l = 0; l < nb; ++l) {
+		    yr[l * ovs] = br[e + 2 * l];
+		    yi[l * ovs] = bi[e + 2 * l];
+	       }
+	  }
+}
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT nb = ego->nb, vl = ego->vl, i;
+     R *buf = (R *) MALLOC(sizeof(R) * 2 * nb * ego->n0 * ego->n1, BUFFERS);
+     plan_dft *cld = (plan_dft *) ego->cld;
+     plan_dft *cldrest;
+
+     for (i = nb; i <= vl; i += nb) {
+	  gather(ego, ri, ii, buf);
+	  ri += ego->ivs * nb; ii += ego->ivs * nb;
+
+	  cld->apply((plan *) cld, buf + ego->roffset, buf + ego->ioffset,
+		     buf + ego->roffset, buf + ego->ioffset);
+
+	  scatter(ego, buf, ro, io);
+	  ro += ego->ovs * nb; io += ego->ovs * nb;
+     }
+
+     X(ifree)(buf);
+
+     /* do the remaining blocks, if any */
+     cldrest = (plan_dft *) ego->cldrest;
+     cldrest->apply((plan *) cldrest, ri, ii, ro, io);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-batch2d-%Dx%D%v/%D%(%p%)%(%p%))",
+	      ego->n0, ego->n1, ego->nb, ego->vl, ego->cld, ego->cldrest);
+}
+
+static int applicable(const S *ego, const problem *p_, const planner *plnr)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     const iodim *d = p->sz->dims, *v = p->vecsz->dims;
+
+     if (NO_BUFFERINGP(plnr)) return 0;
+
+     return (1
+	     && p->sz->rnk == 2
+	     && p->vecsz->rnk == 1
+	     && d[0].n * d[1].n <= MAXBLK
+	     && v[0].n >= ego->nb
+
+	     /* the buffer layout itself: don't recurse */
+	     && !(X(iabs)(v[0].is) == 2 && X(iabs)(v[0].os) == 2)
+
+	     /* in place, each batch must be written where it was read */
+	     && (p->ri != p->ro
+		 || X(tensor_inplace_strides2)(p->sz, p->vecsz))
+	  );
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln;
+     plan *cld = 0, *cldrest = 0;
+     R *buf = 0;
+     INT n0, n1, nb, vl, ivs, ovs;
+     int roffset, ioffset;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_, plnr))
+	  return (plan *) 0;
+
+     n0 = p->sz->dims[0].n;
+     n1 = p->sz->dims[1].n;
+     nb = ego->nb;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+
+     /* keep real and imaginary parts in the same order as the
+	input, as buffered.c does */
+     roffset = (p->ri - p->ii > 0) ? 1 : 0;
+     ioffset = 1 - roffset;
+
+     /* initial allocation for the purpose of planning */
+     buf = (R *) MALLOC(sizeof(R) * 2 * nb * n0 * n1, BUFFERS);
+
+     cld = X(mkplan_f_d)(plnr,
+			 X(mkproblem_dft_d)(
+			      X(mktensor_2d)(n0, 2 * nb * n1, 2 * nb * n1,
+					     n1, 2 * nb, 2 * nb),
+			      X(mktensor_1d)(nb, 2, 2),
+			      buf + roffset, buf + ioffset,
+			      buf + roffset, buf + ioffset),
+			 0, 0, NO_DESTROY_INPUT);
+     if (!cld)
+	  goto nada;
+
+     /* deallocate buffer, let apply() allocate it for real */
+     X(ifree)(buf);
+     buf = 0;
+
+     {
+	  INT id = ivs * (nb * (vl / nb));
+	  INT od = ovs * (nb * (vl / nb));
+	  cldrest = X(mkplan_d)(plnr,
+				X(mkproblem_dft_d)(
+				     X(tensor_copy)(p->sz),
+				     X(mktensor_1d)(vl % nb, ivs, ovs),
+				     p->ri + id, p->ii + id,
+				     p->ro + od, p->io + od));
+     }
+     if (!cldrest)
+	  goto nada;
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+     pln->cld = cld;
+     pln->cldrest = cldrest;
+     pln->n0 = n0;
+     pln->n1 = n1;
+     pln->is0 = p->sz->dims[0].is;
+     pln->is1 = p->sz->dims[1].is;
+     pln->os0 = p->sz->dims[0].os;
+     pln->os1 = p->sz->dims[1].os;
+     pln->nb = nb;
+     pln->vl = vl;
+     pln->ivs = ivs;
+     pln->ovs = ovs;
+     pln->roffset = roffset;
+     pln->ioffset = ioffset;
+
+     {
+	  opcnt t;
+	  X(ops_zero)(&t);
+	  t.other = 4 * n0 * n1 * nb;
+	  X(ops_add2)(&cld->ops, &t);
+	  X(ops_madd)(vl / nb, &t, &cldrest->ops, &pln->super.super.ops);
+     }
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(buf);
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cld);
+     return (plan *) 0;
+}
+
+static solver *mksolver(INT nb)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->nb = nb;
+     return &(slv->super);
+}
+
+void X(dft_batch2d_register)(planner *p)
+{
+     static const INT nbs[] = { 8, 32 };
+     size_t i;
+
+     for (i = 0; i < NELEM(nbs); ++i)
+	  REGISTER_SOLVER(p, mksolver(nbs[i]));
+}
@@ -79,6 +79,31 @@ static void mktwiddle(enum wakefulness wakefulness, P *p)
      }
 }
 
+/* cyclic convolution of the NB complex numbers B with the kernel
+   whose DFT divided by NB is W, by a forward DFT CLDF of size NB and
+   the same DFT acting as an inverse DFT with real and imaginary parts
+   swapped.  The result is left in B with real and imaginary parts
+   swapped. */
+void X(bluestein_convolve)(const plan *cldf_, INT nb, const R *W, R *b)
+{
+     plan_dft *cldf = (plan_dft *)cldf_;
+     INT i;
+
+     /* convolution: FFT */
+     cldf->apply(cldf_, b, b+1, b, b+1);
+
+     /* convolution: pointwise multiplication */
+     for (i = 0; i < nb; ++i) {
+	  E xr = b[2*i], xi = b[2*i+1];
+          E wr = W[2*i], wi = W[2*i+1];
+          b[2*i] = xi * wr + xr * wi;
+          b[2*i+1] = xr * wr - xi * wi;
+     }
+
+     /* convolution: IFFT by FFT with real/imag input/output swapped */
+     cldf->apply(cldf_, b, b+1, b, b+1);
+}
+
 static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 {
      const P *ego = (const P *) ego_;
@@ -96,25 +121,7 @@ static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
 
      for (; i < nb; ++i) b[2*i] = b[2*i+1] = K(0.0);
 
-     /* convolution: FFT */
-     {
-          plan_dft *cldf = (plan_dft *)ego->cldf;
-          cldf->apply(ego->cldf, b, b+1, b, b+1);
-     }
-
-     /* convolution: pointwise multiplication */
-     for (i = 0; i < nb; ++i) {
-	  E xr = b[2*i], xi = b[2*i+1];
-          E wr = W[2*i], wi = W[2*i+1];
-          b[2*i] = xi * wr + xr * wi;
-          b[2*i+1] = xr * wr - xi * wi;
-     }
-
-     /* convolution: IFFT by FFT with real/imag input/output swapped */
-     {
-          plan_dft *cldf = (plan_dft *)ego->cldf;
-          cldf->apply(ego->cldf, b, b+1, b, b+1);
-     }
+     X(bluestein_convolve)(ego->cldf, nb, W, b);
 
      /* multiply output by conjugate bluestein sequence */
      for (i = 0; i < n; ++i) {
@@ -177,7 +184,8 @@ static void print(const plan *ego_, printer *p)
               ego->n, ego->nb, ego->cldf);
 }
 
-static INT choose_transform_size(INT minsz)
+/* smallest size >= MINSZ whose DFT is fast */
+INT X(bluestein_size)(INT minsz)
 {
      while (!X(factors_into_small_primes)(minsz))
 	  ++minsz;
@@ -200,7 +208,7 @@ static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
 	  return (plan *) 0;
 
      n = p->sz->dims[0].n;
-     nb = choose_transform_size(2 * n - 1);
+     nb = X(bluestein_size)(2 * n - 1);
      buf = (R *) MALLOC(2 * nb * sizeof(R), BUFFERS);
 
      cldf = X(mkplan_f_d)(plnr, 
@@ -115,5 +115,6 @@ extern const solvtab X(solvtab_dft_lsx);
 extern const solvtab X(solvtab_dft_lasx);
 extern const solvtab X(solvtab_dft_generic_simd128);
 extern const solvtab X(solvtab_dft_generic_simd256);
+extern const solvtab X(solvtab_dft_generic_simd512);
 
 #endif				/* __DFT_CODELET_H__ */
@@ -27,13 +27,20 @@ static const solvtab s =
      SOLVTAB(X(dft_indirect_transpose_register)),
      SOLVTAB(X(dft_rank_geq2_register)),
      SOLVTAB(X(dft_vrank_geq1_register)),
+     SOLVTAB(X(dft_vsplit_register)),
      SOLVTAB(X(dft_buffered_register)),
+     SOLVTAB(X(dft_aligned_register)),
+     SOLVTAB(X(dft_layout_register)),
+     SOLVTAB(X(dft_batch2d_register)),
      SOLVTAB(X(dft_generic_register)),
      SOLVTAB(X(dft_rader_register)),
      SOLVTAB(X(dft_bluestein_register)),
      SOLVTAB(X(dft_nop_register)),
      SOLVTAB(X(ct_generic_register)),
      SOLVTAB(X(ct_genericbuf_register)),
+     SOLVTAB(X(dft_ooc_register)),
+     SOLVTAB(X(nufft_register)),
+     SOLVTAB(X(czt_register)),
      SOLVTAB_END
 };
 
@@ -105,4 +112,7 @@ void X(dft_conf_standard)(planner *p)
 #if HAVE_GENERIC_SIMD256
      X(solvtab_exec)(X(solvtab_dft_generic_simd256), p);
 #endif
+#if HAVE_GENERIC_SIMD512
+     X(solvtab_exec)(X(solvtab_dft_generic_simd512), p);
+#endif
 }
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Chirp-z transform by Bluestein's algorithm:
+
+   X[k] = sum_{j<n} x[j] exp(FFT_SIGN 2 pi i j (f0 + k df)),  k < m,
+
+   writing j k = (j^2 + k^2 - (k - j)^2) / 2 turns the sum into a
+   pre-multiplication by a chirp, a linear convolution with a chirp,
+   and a post-multiplication by a chirp.  As in bluestein.c, the
+   convolution is computed by zero-padding to a size NB >= n + m - 1
+   and two DFTs of size NB, the second acting as an inverse DFT by
+   swapping real and imaginary parts, exactly as in bluestein.c.  The chirps and the spectrum W
+   of the convolution kernel only depend on the plan, and are computed
+   once when the plan is awakened. */
+
+#include "dft/dft.h"
+#include <math.h>
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+     INT n, m;   /* input and output sizes */
+     INT nb;     /* size of convolution */
+     double f0, df;
+     R *a;       /* pre-multiplication chirp */
+     R *c;       /* post-multiplication chirp */
+     R *W;       /* DFT(convolution kernel) / nb */
+     plan *cldf;
+     INT is, os;
+} P;
+
+/* exact product A B = *P + *E of two doubles (Dekker) */
+static void two_prod(double a, double b, double *p, double *e)
+{
+     const double split = 134217729.0; /* 2^27 + 1 */
+     double t, ah, al, bh, bl;
+
+     *p = a * b;
+     t = split * a; ah = t - (t - a); al = a - ah;
+     t = split * b; bh = t - (t - b); bl = b - bh;
+     *e = ((ah * bh - *p) + ah * bl + al * bh) + al * bl;
+}
+
+/* fractional part of a double, which is exact */
+static double fracd(double t)
+{
+     return t - floor(t);
+}
+
+/* fractional part of A I J, for I, J < 2^53.  I J = q1 + q2 and
+   A q1 = p1 + e1, A q2 = p2 + e2 exactly, and the fractional parts of
+   the four doubles are exact, so the only rounding is in their sum.
+   Forming A I J in floating point instead loses the fractional part
+   as soon as A I J is large. */
+static trigreal frac_prod(double a, INT i, INT j)
+{
+     double q1, q2, p1, e1, p2, e2;
+     trigreal t;
+
+     two_prod((double)i, (double)j, &q1, &q2);
+     two_prod(a, q1, &p1, &e1);
+     two_prod(a, q2, &p2, &e2);
+     t = ((trigreal)fracd(p1) + (trigreal)fracd(e1))
+	  + ((trigreal)fracd(p2) + (trigreal)fracd(e2));
+     return t - (trigreal)(INT)t;
+}
+
+/* res = exp(sign 2 pi i t) */
+static void cexp_cycles(trigreal t, int sign, R *res)
+{
+     trigreal w[2];
+     X(cexpl_cycles)(t, w);
+     res[0] = (R) w[0];
+     res[1] = (R) (sign * w[1]);
+}
+
+static void mktables(P *p)
+{
+     INT i, n = p->n, m = p->m, nb = p->nb;
+     double f0 = p->f0, hdf = 0.5 * p->df;
+     R *a, *c, *W;
+     E nbf = (E)nb;
+
+     p->a = a = (R *) MALLOC(2 * n * sizeof(R), TWIDDLES);
+     p->c = c = (R *) MALLOC(2 * m * sizeof(R), TWIDDLES);
+     p->W = W = (R *) MALLOC(2 * nb * sizeof(R), TWIDDLES);
+
+     /* all phases are f0 or df/2 times an integer, so only their
+	fractional parts matter */
+     for (i = 0; i < n; ++i) 
+	  cexp_cycles(frac_prod(f0, i, 1) + frac_prod(hdf, i, i),
+		      FFT_SIGN, a + 2 * i);
+
+     for (i = 0; i < m; ++i) 
+	  cexp_cycles(frac_prod(hdf, i, i), FFT_SIGN, c + 2 * i);
+
+     /* the kernel exp(-FFT_SIGN pi i df l^2) for -n < l < m, wrapped
+	around modulo nb; it is even in l */
+     for (i = 0; i < nb; ++i)
+          W[2*i] = W[2*i+1] = K(0.0);
+
+     for (i = 0; i < n || i < m; ++i) {
+	  R w[2];
+	  cexp_cycles(frac_prod(hdf, i, i), -FFT_SIGN, w);
+	  if (i < m) {
+	       W[2*i] = w[0] / nbf;
+	       W[2*i+1] = w[1] / nbf;
+	  }
+	  if (i > 0 && i < n) {
+	       W[2*(nb-i)] = w[0] / nbf;
+	       W[2*(nb-i)+1] = w[1] / nbf;
+	  }
+     }
+
+     {
+          plan_dft *cldf = (plan_dft *)p->cldf;
+	  /* cldf must be awake */
+          cldf->apply(p->cldf, W, W+1, W, W+1);
+     }
+}
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT i, n = ego->n, m = ego->m, nb = ego->nb;
+     INT is = ego->is, os = ego->os;
+     R *a = ego->a, *c = ego->c;
+     R *b = (R *) MALLOC(2 * nb * sizeof(R), BUFFERS);
+
+     /* multiply input by the pre-multiplication chirp */
+     for (i = 0; i < n; ++i) {
+	  E xr = ri[i*is], xi = ii[i*is];
+          E wr = a[2*i], wi = a[2*i+1];
+          b[2*i] = xr * wr - xi * wi;
+          b[2*i+1] = xi * wr + xr * wi;
+     }
+
+     for (; i < nb; ++i) b[2*i] = b[2*i+1] = K(0.0);
+
+     X(bluestein_convolve)(ego->cldf, nb, ego->W, b);
+
+     /* multiply output by the post-multiplication chirp.  The input
+	has been consumed, so this works in place too. */
+     for (i = 0; i < m; ++i) {
+	  E xi = b[2*i], xr = b[2*i+1];
+          E wr = c[2*i], wi = c[2*i+1];
+          ro[i*os] = xr * wr - xi * wi;
+          io[i*os] = xi * wr + xr * wi;
+     }
+
+     X(ifree)(b);	  
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cldf, wakefulness);
+
+     switch (wakefulness) {
+	 case SLEEPY:
+	      X(ifree0)(ego->a); ego->a = 0;
+	      X(ifree0)(ego->c); ego->c = 0;
+	      X(ifree0)(ego->W); ego->W = 0;
+	      break;
+	 default:
+	      A(!ego->W);
+	      mktables(ego);
+	      break;
+     }
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldf);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *)ego_;
+     p->print(p, "(czt-%D-%D/%D%(%p%))",
+              ego->n, ego->m, ego->nb, ego->cldf);
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     const problem_czt *p = (const problem_czt *) p_;
+     P *pln;
+     INT n, m, nb;
+     plan *cldf = 0;
+     R *buf = (R *) 0;
+
+     static const plan_adt padt = {
+	  X(czt_solve), awake, print, destroy
+     };
+
+     UNUSED(ego);
+
+     n = p->n;
+     m = p->m;
+     nb = X(bluestein_size)(n + m - 1);
+     buf = (R *) MALLOC(2 * nb * sizeof(R), BUFFERS);
+
+     cldf = X(mkplan_d)(plnr, 
+			X(mkproblem_dft_d)(X(mktensor_1d)(nb, 2, 2),
+					   X(mktensor_1d)(1, 0, 0),
+					   buf, buf+1, 
+					   buf, buf+1));
+     if (!cldf) goto nada;
+
+     X(ifree)(buf);
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+
+     pln->n = n;
+     pln->m = m;
+     pln->nb = nb;
+     pln->f0 = p->f0;
+     pln->df = p->df;
+     pln->a = 0;
+     pln->c = 0;
+     pln->W = 0;
+     pln->cldf = cldf;
+     pln->is = p->is;
+     pln->os = p->os;
+
+     X(ops_madd2)(2, &cldf->ops, &pln->super.super.ops);
+     pln->super.super.ops.add += 2 * (n + m + nb);
+     pln->super.super.ops.mul += 4 * (n + m + nb);
+     pln->super.super.ops.other += 6 * (n + m + nb);
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(buf);
+     X(plan_destroy_internal)(cldf);
+     return (plan *)0;
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_CZT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(czt_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
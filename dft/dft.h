@@ -59,6 +59,94 @@ plan *X(mkplan_dft)(size_t size, const plan_adt *adt, dftapply apply);
 #define MKPLAN_DFT(type, adt, apply) \
   (type *)X(mkplan_dft)(sizeof(type), adt, apply)
 
+/* problem-ooc.c: out-of-core dft, data stored in files */
+typedef struct {
+     problem super;
+     tensor *sz;                /* row-major, strides in complex elements */
+     int ifd, ofd;		/* file descriptors */
+     INT iofs, oofs;		/* byte offsets of the data in the files */
+     int sign;
+} problem_dft_ooc;
+
+problem *X(mkproblem_dft_ooc)(int rnk, const INT *n,
+			      int ifd, INT iofs, int ofd, INT oofs,
+			      int sign);
+
+/* solve-ooc.c: */
+void X(dft_ooc_solve)(const plan *ego_, const problem *p_);
+
+/* plan-ooc.c: */
+/* returns zero if a read or write failed */
+typedef int (*dftoocapply) (const plan *ego, 
+			    int ifd, INT iofs, int ofd, INT oofs);
+
+typedef struct {
+     plan super;
+     dftoocapply apply;
+} plan_dft_ooc;
+
+plan *X(mkplan_dft_ooc)(size_t size, const plan_adt *adt, dftoocapply apply);
+
+#define MKPLAN_DFT_OOC(type, adt, apply) \
+  (type *)X(mkplan_dft_ooc)(sizeof(type), adt, apply)
+
+/* problem-nufft.c: non-uniform DFT.  Type 1 maps M non-uniform points
+   to uniform modes, type 2 maps modes to points. */
+typedef struct {
+     problem super;
+     int type;
+     tensor *sz;		/* modes, row-major, strides in complex elements */
+     INT m;			/* number of points */
+     R *x;			/* m x rnk coordinates, period 2 pi */
+     R *c, *f;			/* point strengths and modes, interleaved */
+     int sign;
+     int w;			/* spreading width, from the tolerance */
+} problem_nufft;
+
+problem *X(mkproblem_nufft)(int type, int rnk, const INT *n, INT m,
+			    R *x, R *c, R *f, int sign, double eps);
+
+/* solve-nufft.c: */
+void X(nufft_solve)(const plan *ego_, const problem *p_);
+
+/* plan-nufft.c: */
+typedef void (*nufftapply) (const plan *ego, R *x, R *c, R *f);
+
+typedef struct {
+     plan super;
+     nufftapply apply;
+} plan_nufft;
+
+plan *X(mkplan_nufft)(size_t size, const plan_adt *adt, nufftapply apply);
+
+#define MKPLAN_NUFFT(type, adt, apply) \
+  (type *)X(mkplan_nufft)(sizeof(type), adt, apply)
+
+/* nufft.c: set by the threads library to run spreading in parallel */
+extern void (*X(nufft_spawn_hook))(int nthr, void (*work)(void *, int),
+				   void *data);
+
+/* problem-czt.c: chirp-z transform
+   X[k] = sum_{j<n} x[j] exp(FFT_SIGN 2 pi i j (f0 + k df)), k < m */
+typedef struct {
+     problem super;
+     INT n, m;
+     INT is, os;
+     R *ri, *ii, *ro, *io;
+     double f0, df;
+} problem_czt;
+
+problem *X(mkproblem_czt)(INT n, INT m, INT is, INT os,
+			  R *ri, R *ii, R *ro, R *io,
+			  double f0, double df);
+
+/* solve-czt.c: */
+void X(czt_solve)(const plan *ego_, const problem *p_);
+
+/* bluestein.c: convolution shared with czt.c */
+INT X(bluestein_size)(INT minsz);
+void X(bluestein_convolve)(const plan *cldf, INT nb, const R *W, R *b);
+
 /* various solvers */
 solver *X(mksolver_dft_direct)(kdft k, const kdft_desc *desc);
 solver *X(mksolver_dft_directbuf)(kdft k, const kdft_desc *desc);
@@ -68,13 +156,20 @@ void X(dft_rank_geq2_register)(planner *p);
 void X(dft_indirect_register)(planner *p);
 void X(dft_indirect_transpose_register)(planner *p);
 void X(dft_vrank_geq1_register)(planner *p);
+void X(dft_vsplit_register)(planner *p);
 void X(dft_vrank2_transpose_register)(planner *p);
 void X(dft_vrank3_transpose_register)(planner *p);
 void X(dft_buffered_register)(planner *p);
+void X(dft_aligned_register)(planner *p);
+void X(dft_layout_register)(planner *p);
+void X(dft_batch2d_register)(planner *p);
 void X(dft_generic_register)(planner *p);
 void X(dft_rader_register)(planner *p);
 void X(dft_bluestein_register)(planner *p);
 void X(dft_nop_register)(planner *p);
+void X(dft_ooc_register)(planner *p);
+void X(nufft_register)(planner *p);
+void X(czt_register)(planner *p);
 void X(ct_generic_register)(planner *p);
 void X(ct_genericbuf_register)(planner *p);
 
@@ -294,7 +294,8 @@ static plan *mkcldw(const ct_solver *ego_,
      pln->extra_iter = extra_iter;
 
      X(ops_zero)(&pln->super.super.ops);
-     X(ops_madd2)(v * (mcount/e->genus->vl), &e->ops, &pln->super.super.ops);
+     X(ops_madd2)(v * ((mcount + e->genus->vl - 1) / e->genus->vl),
+		  &e->ops, &pln->super.super.ops);
 
      if (ego->bufferedp) {
 	  /* 8 load/stores * N * V */
@@ -263,7 +263,8 @@ static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
      pln->slv = ego;
 
      X(ops_zero)(&pln->super.super.ops);
-     X(ops_madd2)(pln->vl / e->genus->vl, &e->ops, &pln->super.super.ops);
+     X(ops_madd2)((pln->vl + e->genus->vl - 1) / e->genus->vl,
+		  &e->ops, &pln->super.super.ops);
 
      if (ego->bufferedp) 
 	  pln->super.super.ops.other += 4 * pln->n * pln->vl;
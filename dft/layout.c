@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+/* Transforms between split and interleaved arrays.  The SIMD codelets
+   require interleaved real and imaginary parts on both sides, so such
+   problems fall back to scalar codelets.  Here, for split input and
+   interleaved output, we interleave the input into the output array
+   and transform it in place there; for interleaved input and split
+   output, we transform into an interleaved buffer and split it into
+   the output.  Either way the conversion is a single pass of
+   X(cpy2d_pair), which does the (de)interleaving of unit-stride
+   arrays with SIMD shuffles. */
+
+#include "dft/dft.h"
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+
+     plan *cld;
+     INT n, is, os, vl, ivs, ovs;
+     INT bufsz, roffset, ioffset;
+} P;
+
+/* split input: interleave into the output, then transform in place */
+static void apply_before(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+
+     X(cpy2d_pair_co)(ri, ii, ro, io,
+		      ego->n, ego->is, ego->os,
+		      ego->vl, ego->ivs, ego->ovs);
+     {
+	  plan_dft *cld = (plan_dft *) ego->cld;
+	  cld->apply((plan *) cld, ro, io, ro, io);
+     }
+}
+
+/* split output: transform into an interleaved buffer, then split it */
+static void apply_after(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT n = ego->n;
+     R *buf = (R *) MALLOC(sizeof(R) * ego->bufsz, BUFFERS);
+     R *br = buf + ego->roffset, *bi = buf + ego->ioffset;
+
+     {
+	  plan_dft *cld = (plan_dft *) ego->cld;
+	  cld->apply((plan *) cld, ri, ii, br, bi);
+     }
+     X(cpy2d_pair_ci)(br, bi, ro, io,
+		      n, 2, ego->os,
+		      ego->vl, 2 * n, ego->ovs);
+
+     X(ifree)(buf);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     X(plan_awake)(ego->cld, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-layout-%s-%D%v%(%p%))",
+	      ego->super.apply == apply_before ? "interleave" : "split",
+	      ego->n, ego->vl, ego->cld);
+}
+
+static int interleaved(const R *r, const R *i)
+{
+     r = UNTAINT(r);
+     i = UNTAINT(i);
+     return (i == r + 1 || r == i + 1);
+}
+
+static int applicable(const problem *p_, const planner *plnr)
+{
+#if HAVE_SIMD
+     const problem_dft *p = (const problem_dft *) p_;
+
+     if (NO_SIMDP(plnr))
+	  return 0;
+
+     if (!(1
+	   && p->sz->rnk == 1
+	   && p->vecsz->rnk <= 1
+	   && p->ri != p->ro
+	   && interleaved(p->ri, p->ii) != interleaved(p->ro, p->io)))
+	  return 0;
+
+     /* split output needs a buffer for the whole problem */
+     if (!interleaved(p->ro, p->io)
+	 && (NO_BUFFERINGP(plnr)
+	     || (CONSERVE_MEMORYP(plnr)
+		 && X(toobig)(X(tensor_sz)(p->sz)
+			      * X(tensor_sz)(p->vecsz)))))
+	  return 0;
+
+     return 1;
+#else
+     /* without SIMD there is nothing to gain */
+     UNUSED(p_); UNUSED(plnr);
+     return 0;
+#endif
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     P *pln;
+     plan *cld = (plan *) 0;
+     const problem_dft *p = (const problem_dft *) p_;
+     R *buf = (R *) 0;
+     INT n, is, os, vl, ivs, ovs, roffset = 0;
+     int before;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     UNUSED(ego);
+     if (!applicable(p_, plnr))
+          return (plan *) 0;
+
+     n = p->sz->dims[0].n;
+     is = p->sz->dims[0].is;
+     os = p->sz->dims[0].os;
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+     before = !interleaved(p->ri, p->ii);
+
+     if (before) {
+	  cld = X(mkplan_d)(plnr,
+			    X(mkproblem_dft_d)(
+				 X(mktensor_1d)(n, os, os),
+				 X(mktensor_1d)(vl, ovs, ovs),
+				 p->ro, p->io, p->ro, p->io));
+     } else {
+	  /* keep real and imaginary parts in the same order in the
+	     buffer as in the input, as in dft-aligned.  Only here are
+	     they parts of the same array. */
+	  roffset = (UNTAINT(p->ri) > UNTAINT(p->ii)) ? (INT)1 : (INT)0;
+
+	  /* initial allocation for the purpose of planning */
+	  buf = (R *) MALLOC(sizeof(R) * 2 * n * vl, BUFFERS);
+	  cld = X(mkplan_d)(plnr,
+			    X(mkproblem_dft_d)(
+				 X(mktensor_1d)(n, is, 2),
+				 X(mktensor_1d)(vl, ivs, 2 * n),
+				 p->ri, p->ii,
+				 buf + roffset, buf + (1 - roffset)));
+
+	  /* deallocate buffer, let apply() allocate it for real */
+	  X(ifree)(buf);
+     }
+     if (!cld)
+	  return (plan *) 0;
+
+     pln = MKPLAN_DFT(P, &padt, before ? apply_before : apply_after);
+     pln->cld = cld;
+     pln->n = n;
+     pln->is = is;
+     pln->os = os;
+     pln->vl = vl;
+     pln->ivs = ivs;
+     pln->ovs = ovs;
+     pln->bufsz = before ? 0 : 2 * n * vl;
+     pln->roffset = roffset;
+     pln->ioffset = 1 - roffset;
+
+     X(ops_cpy)(&cld->ops, &pln->super.super.ops);
+     /* the conversion pass */
+     pln->super.super.ops.other += 2 * n * vl;
+
+     return &(pln->super.super);
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(dft_layout_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
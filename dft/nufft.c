@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* non-uniform DFT by spreading onto an oversampled grid.
+
+   Type 1: spread each point onto a grid twice the size of the modes
+   with a kernel of compact support, transform the grid, and divide
+   each mode by the Fourier transform of the kernel.  Type 2 performs
+   the same steps in reverse order.  See A. H. Barnett, J. Magland, and
+   L. af Klinteberg, "A parallel nonuniform fast Fourier transform
+   library based on an `exponential of semicircle' kernel," SIAM
+   J. Sci. Comput. 41, C479 (2019).
+
+   The solver is registered once for the exponential-of-semicircle
+   kernel and once for the Kaiser-Bessel kernel, and the planner
+   picks the faster one.  Problems of rank < 3 are padded on the left
+   with dimensions of size 1. */
+
+#include "dft/dft.h"
+#include <math.h>
+
+#define MAXRNK 3
+#define MAXW 16			/* maximum spreading width */
+#define MAXNQ (2 * MAXW + 8)	/* quadrature nodes for the kernel transform */
+
+#define TWOPI 6.2831853071795864769252867665590057683943388
+
+/* approximate cost of one kernel evaluation */
+#define ES_OPS 16
+#define KB_OPS 64
+
+void (*X(nufft_spawn_hook))(int, void (*)(void *, int), void *) = 0;
+
+enum { KERNEL_ES, KERNEL_KB };
+
+typedef struct {
+     solver super;
+     int kernel;
+} S;
+
+typedef struct {
+     plan_nufft super;
+
+     plan *cld;
+     R *fac[MAXRNK];		/* 1 / kernel transform, per mode */
+     double beta, i0beta;
+     INT n[MAXRNK], nf[MAXRNK], ngrid, m;
+     int wd[MAXRNK];		/* spreading width, 1 for padding */
+     int type, sign, kernel, rnk, s, nthr;
+} P;
+
+/* children are forward transforms.  For sign = +1, swap real and
+   imaginary parts, both here and when planning. */
+#define RE(sign) ((sign) == FFT_SIGN ? 0 : 1)
+#define IM(sign) (1 - RE(sign))
+
+#define WRAP(k, n) ((k) < 0 ? (k) + (n) : (k))
+
+/*************************************************************/
+/* kernels */
+
+static double bessel_i0(double x)
+{
+     double s = 1.0, t = 1.0, y = 0.25 * x * x;
+     int k;
+     for (k = 1; t > 1e-17 * s; ++k) {
+	  t *= y / ((double) k * (double) k);
+	  s += t;
+     }
+     return s;
+}
+
+/* kernel at Z in [-1, 1] */
+static double phi(const P *ego, double z)
+{
+     double s = 1.0 - z * z;
+     if (s < 0.0)
+	  return 0.0;
+     if (ego->kernel == KERNEL_ES)
+	  return exp(ego->beta * (sqrt(s) - 1.0));
+     else
+	  return bessel_i0(ego->beta * sqrt(s)) * ego->i0beta;
+}
+
+/* grid position of coordinate X along padded dimension I, in [0, nf].
+   Coordinates that are not finite, such as the garbage in the arrays
+   while the planner measures, are mapped to 0 so that the grid is
+   never indexed out of bounds. */
+static double gridpos(const P *ego, int i, R x)
+{
+     double nf = (double) ego->nf[i];
+     double u = (double) x * nf / TWOPI;
+     u -= nf * floor(u / nf);
+     return (u >= 0.0 && u <= nf) ? u : 0.0;
+}
+
+/* grid indices and kernel values of the support of point XJ */
+static void support(const P *ego, const R *xj,
+		    INT idx[MAXRNK][MAXW], double ker[MAXRNK][MAXW])
+{
+     int i, q, i0 = MAXRNK - ego->rnk;
+
+     for (i = 0; i < MAXRNK; ++i) {
+	  int w = ego->wd[i];
+	  if (w == 1) {
+	       idx[i][0] = 0;
+	       ker[i][0] = 1.0;
+	  } else {
+	       double h = 0.5 * w, u = gridpos(ego, i, xj[i - i0]);
+	       double l0 = ceil(u - h);
+	       INT l = (INT) l0;
+	       for (q = 0; q < w; ++q) {
+		    idx[i][q] = X(modulo)(l + q, ego->nf[i]);
+		    ker[i][q] = phi(ego, (l0 + q - u) / h);
+	       }
+	  }
+     }
+}
+
+/* TRUE if the support of XJ along the slab dimension intersects
+   [LO, HI) */
+static int touches(const P *ego, const R *xj, INT lo, INT hi)
+{
+     int i = ego->s, q, w = ego->wd[i];
+     INT l = (INT) ceil(gridpos(ego, i, xj[i - (MAXRNK - ego->rnk)]) 
+			- 0.5 * w);
+     for (q = 0; q < w; ++q) {
+	  INT k = X(modulo)(l + q, ego->nf[i]);
+	  if (k >= lo && k < hi)
+	       return 1;
+     }
+     return 0;
+}
+
+/*************************************************************/
+/* spreading and interpolation */
+
+#define INSLAB(i, k) (ego->s != (i) || ((k) >= lo && (k) < hi))
+
+/* add (CR, CI) times the kernel centered at XJ to the grid points of
+   the slab [LO, HI) */
+static void spread(const P *ego, R *grid, const R *xj, R cr, R ci,
+		   INT lo, INT hi)
+{
+     INT idx[MAXRNK][MAXW];
+     double ker[MAXRNK][MAXW];
+     INT nf1 = ego->nf[1], nf2 = ego->nf[2];
+     int a, b, q;
+
+     support(ego, xj, idx, ker);
+     for (a = 0; a < ego->wd[0]; ++a) {
+	  if (!INSLAB(0, idx[0][a])) continue;
+	  for (b = 0; b < ego->wd[1]; ++b) {
+	       double kab = ker[0][a] * ker[1][b];
+	       R *row = grid + 2 * (idx[0][a] * nf1 + idx[1][b]) * nf2;
+	       if (!INSLAB(1, idx[1][b])) continue;
+	       for (q = 0; q < ego->wd[2]; ++q) {
+		    R k = (R) (kab * ker[2][q]);
+		    R *g = row + 2 * idx[2][q];
+		    if (!INSLAB(2, idx[2][q])) continue;
+		    g[0] += k * cr;
+		    g[1] += k * ci;
+	       }
+	  }
+     }
+}
+
+/* interpolate the grid at XJ */
+static void interp(const P *ego, const R *grid, const R *xj, R *cj)
+{
+     INT idx[MAXRNK][MAXW];
+     double ker[MAXRNK][MAXW];
+     INT nf1 = ego->nf[1], nf2 = ego->nf[2];
+     R cr = K(0.0), ci = K(0.0);
+     int a, b, q;
+
+     support(ego, xj, idx, ker);
+     for (a = 0; a < ego->wd[0]; ++a) {
+	  for (b = 0; b < ego->wd[1]; ++b) {
+	       double kab = ker[0][a] * ker[1][b];
+	       const R *row = grid + 2 * (idx[0][a] * nf1 + idx[1][b]) * nf2;
+	       for (q = 0; q < ego->wd[2]; ++q) {
+		    R k = (R) (kab * ker[2][q]);
+		    const R *g = row + 2 * idx[2][q];
+		    cr += k * g[0];
+		    ci += k * g[1];
+	       }
+	  }
+     }
+     cj[0] = cr;
+     cj[1] = ci;
+}
+
+typedef struct {
+     const P *ego;
+     R *grid, *x, *c;
+} WD;
+
+/* thread T owns a slab of the grid along dimension s, and spreads
+   the part of each point that falls into the slab */
+static void spread_work(void *d_, int t)
+{
+     const WD *d = (const WD *) d_;
+     const P *ego = d->ego;
+     INT nfs = ego->nf[ego->s], j;
+     INT lo = (t * nfs) / ego->nthr, hi = ((t + 1) * nfs) / ego->nthr;
+
+     for (j = 0; j < ego->m; ++j) {
+	  const R *xj = d->x + j * ego->rnk;
+	  if (ego->nthr > 1 && !touches(ego, xj, lo, hi))
+	       continue;
+	  spread(ego, d->grid, xj, d->c[2 * j], d->c[2 * j + 1], lo, hi);
+     }
+}
+
+/* thread T interpolates a contiguous range of points */
+static void interp_work(void *d_, int t)
+{
+     const WD *d = (const WD *) d_;
+     const P *ego = d->ego;
+     INT j, jb = (t * ego->m) / ego->nthr, je = ((t + 1) * ego->m) / ego->nthr;
+
+     for (j = jb; j < je; ++j)
+	  interp(ego, d->grid, d->x + j * ego->rnk, d->c + 2 * j);
+}
+
+static void loop(const P *ego, void (*work)(void *, int), WD *d)
+{
+     if (ego->nthr > 1)
+	  X(nufft_spawn_hook)(ego->nthr, work, (void *) d);
+     else
+	  work((void *) d, 0);
+}
+
+/* type 1: modes = grid / kernel transform.  Type 2: grid = modes /
+   kernel transform, where the rest of the grid is zero. */
+static void modes(const P *ego, R *grid, R *f)
+{
+     INT n0 = ego->n[0], n1 = ego->n[1], n2 = ego->n[2];
+     INT nf0 = ego->nf[0], nf1 = ego->nf[1], nf2 = ego->nf[2];
+     INT p0, p1, p2;
+
+     for (p0 = 0; p0 < n0; ++p0) {
+	  INT g0 = WRAP(p0 - n0 / 2, nf0);
+	  for (p1 = 0; p1 < n1; ++p1) {
+	       INT g1 = WRAP(p1 - n1 / 2, nf1);
+	       R s01 = ego->fac[0][p0] * ego->fac[1][p1];
+	       R *frow = f + 2 * (p0 * n1 + p1) * n2;
+	       R *grow = grid + 2 * (g0 * nf1 + g1) * nf2;
+	       for (p2 = 0; p2 < n2; ++p2) {
+		    INT g2 = WRAP(p2 - n2 / 2, nf2);
+		    R s = s01 * ego->fac[2][p2];
+		    if (ego->type == 1) {
+			 frow[2 * p2] = s * grow[2 * g2];
+			 frow[2 * p2 + 1] = s * grow[2 * g2 + 1];
+		    } else {
+			 grow[2 * g2] = s * frow[2 * p2];
+			 grow[2 * g2 + 1] = s * frow[2 * p2 + 1];
+		    }
+	       }
+	  }
+     }
+}
+
+static void apply(const plan *ego_, R *x, R *c, R *f)
+{
+     const P *ego = (const P *) ego_;
+     plan_dft *cld = (plan_dft *) ego->cld;
+     int re = RE(ego->sign), im = IM(ego->sign);
+     R *grid = (R *) MALLOC(sizeof(R) * 2 * ego->ngrid, BUFFERS);
+     WD d;
+     INT i;
+
+     for (i = 0; i < 2 * ego->ngrid; ++i)
+	  grid[i] = K(0.0);
+     d.ego = ego; d.grid = grid; d.x = x; d.c = c;
+
+     if (ego->type == 1) {
+	  loop(ego, spread_work, &d);
+	  cld->apply(ego->cld, grid + re, grid + im, grid + re, grid + im);
+	  modes(ego, grid, f);
+     } else {
+	  modes(ego, grid, f);
+	  cld->apply(ego->cld, grid + re, grid + im, grid + re, grid + im);
+	  loop(ego, interp_work, &d);
+     }
+
+     X(ifree)(grid);
+}
+
+/*************************************************************/
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     X(plan_awake)(ego->cld, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     int i;
+     for (i = 0; i < MAXRNK; ++i)
+	  X(ifree0)(ego->fac[i]);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(nufft%d-%s-w%d%v%(%p%))",
+	      ego->type, ego->kernel == KERNEL_ES ? "es" : "kb",
+	      ego->wd[MAXRNK - 1], ego->nthr, ego->cld);
+}
+
+/* Gauss-Legendre nodes and weights on [-1, 1] */
+static void gauss_legendre(int n, double *z, double *wq)
+{
+     int i, j, it;
+
+     for (i = 0; i < n; ++i) {
+	  double x = cos(0.5 * TWOPI * (i + 0.75) / (n + 0.5));
+	  double p0 = 1.0, p1 = x, dp = 1.0, dx;
+	  for (it = 0; it < 100; ++it) {
+	       p0 = 1.0; p1 = x;
+	       for (j = 2; j <= n; ++j) {
+		    double p2 = ((2 * j - 1) * x * p1 - (j - 1) * p0) / j;
+		    p0 = p1; p1 = p2;
+	       }
+	       dp = n * (x * p1 - p0) / (x * x - 1.0);
+	       dx = p1 / dp;
+	       x -= dx;
+	       if (fabs(dx) < 1e-16)
+		    break;
+	  }
+	  z[i] = x;
+	  wq[i] = 2.0 / ((1.0 - x * x) * dp * dp);
+     }
+}
+
+/* 1 / (kernel transform) for the modes of padded dimension I:
+   \hat\phi(k) = 2 \int_0^h \phi(t / h) \cos(2 \pi k t / nf) dt */
+static R *mkfac(const P *ego, int i)
+{
+     INT n = ego->n[i], nf = ego->nf[i], p;
+     int q, nq = 2 * ego->wd[i] + 8;
+     double h = 0.5 * ego->wd[i], z[MAXNQ], wq[MAXNQ];
+     R *fac = (R *) MALLOC(sizeof(R) * n, TWIDDLES);
+
+     if (ego->wd[i] == 1) {
+	  fac[0] = K(1.0);
+	  return fac;
+     }
+
+     gauss_legendre(nq, z, wq);
+     for (p = 0; p < n; ++p) {
+	  double k = (double) (p - n / 2), s = 0.0;
+	  for (q = 0; q < nq; ++q) {
+	       double t = 0.5 * h * (1.0 + z[q]);
+	       s += wq[q] * h * phi(ego, t / h) * cos(TWOPI * k * t / nf);
+	  }
+	  fac[p] = (R) (1.0 / s);
+     }
+     return fac;
+}
+
+/* smallest even 2^a 3^b 5^c >= N */
+static INT goodsize(INT n)
+{
+     for (;; ++n) {
+	  INT m = n;
+	  if (m % 2) continue;
+	  while (m % 2 == 0) m /= 2;
+	  while (m % 3 == 0) m /= 3;
+	  while (m % 5 == 0) m /= 5;
+	  if (m == 1) return n;
+     }
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_nufft *p = (const problem_nufft *) p_;
+     P *pln;
+     plan *cld;
+     R *grid;
+     tensor *sz;
+     INT n[MAXRNK], nf[MAXRNK], ngrid, s;
+     int i, i0 = MAXRNK - p->sz->rnk;
+     int re = RE(p->sign), im = IM(p->sign);
+
+     static const plan_adt padt = {
+	  X(nufft_solve), awake, print, destroy
+     };
+
+     for (i = 0; i < MAXRNK; ++i) {
+	  if (i < i0) {
+	       n[i] = nf[i] = 1;
+	  } else {
+	       n[i] = p->sz->dims[i - i0].n;
+	       nf[i] = goodsize(X(imax)(2 * n[i], 2 * p->w));
+	  }
+     }
+     ngrid = nf[0] * nf[1] * nf[2];
+
+     /* in-place transform of the fine grid */
+     grid = (R *) MALLOC(sizeof(R) * 2 * ngrid, BUFFERS);
+     sz = X(mktensor)(MAXRNK);
+     for (i = MAXRNK - 1, s = 1; i >= 0; --i) {
+	  sz->dims[i].n = nf[i];
+	  sz->dims[i].is = sz->dims[i].os = 2 * s;
+	  s *= nf[i];
+     }
+     cld = X(mkplan_d)(plnr, 
+		       X(mkproblem_dft_d)(sz, X(mktensor_0d)(),
+					  grid + re, grid + im,
+					  grid + re, grid + im));
+     X(ifree)(grid);
+     if (!cld)
+	  return (plan *) 0;
+
+     pln = MKPLAN_NUFFT(P, &padt, apply);
+     pln->cld = cld;
+     pln->type = p->type;
+     pln->sign = p->sign;
+     pln->kernel = ego->kernel;
+     pln->rnk = p->sz->rnk;
+     pln->m = p->m;
+     pln->ngrid = ngrid;
+     pln->s = i0;
+     for (i = 0; i < MAXRNK; ++i) {
+	  pln->n[i] = n[i];
+	  pln->nf[i] = nf[i];
+	  pln->wd[i] = (i < i0) ? 1 : p->w;
+     }
+
+     if (ego->kernel == KERNEL_ES) {
+	  static const double betaoverw[] = { 2.20, 2.26, 2.38 };
+	  pln->beta = p->w * (p->w <= 4 ? betaoverw[p->w - 2] : 2.30);
+	  pln->i0beta = 0.0;
+     } else {
+	  pln->beta = 0.5 * TWOPI * sqrt(0.5625 * p->w * p->w - 0.8);
+	  pln->i0beta = 1.0 / bessel_i0(pln->beta);
+     }
+
+     for (i = 0; i < MAXRNK; ++i)
+	  pln->fac[i] = mkfac(pln, i);
+
+     pln->nthr = 1;
+     if (X(nufft_spawn_hook) && plnr->nthr > 1)
+	  pln->nthr = (int) X(imin)(plnr->nthr, nf[i0]);
+
+     {
+	  opcnt *ops = &pln->super.super.ops;
+	  double w = (double) p->w, npts = (double) p->m;
+	  for (i = i0; i < MAXRNK; ++i)
+	       npts *= w;
+	  X(ops_zero)(ops);
+	  ops->add = 2 * npts;
+	  ops->mul = 3 * npts + 2.0 * X(tensor_sz)(p->sz);
+	  ops->other = (double) p->m * p->sz->rnk * w
+	       * (ego->kernel == KERNEL_ES ? ES_OPS : KB_OPS)
+	       + 2.0 * ngrid;
+	  X(ops_add2)(&cld->ops, ops);
+     }
+
+     return &(pln->super.super);
+}
+
+static solver *mksolver(int kernel)
+{
+     static const solver_adt sadt = { PROBLEM_NUFFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->kernel = kernel;
+     return &(slv->super);
+}
+
+void X(nufft_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver(KERNEL_ES));
+     REGISTER_SOLVER(p, mksolver(KERNEL_KB));
+}
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* out-of-core DFT: the data lives in files and is streamed through
+   in-core buffers of bounded size.
+
+   A rank >= 2 transform is viewed as an N0 x N1 row-major matrix,
+   where N0 is the product of the leading dimensions and N1 the
+   product of the trailing ones.  We first transform blocks of rows
+   (in -> out), then blocks of columns (out -> out).
+
+   A rank-1 transform of size n = n0 * n1 uses the six-step
+   algorithm: columns of length n0 are transformed in place in the
+   input file and multiplied by the twiddle factors, then rows of
+   length n1 are transformed and written transposed into the output
+   file.  This destroys the input.
+
+   The solver is registered once per in-core budget, and the planner
+   picks the block size.  The next block is prefetched with
+   posix_fadvise(), and writeback of each block is started as soon
+   as it has been written, so that I/O overlaps with computation. */
+
+#include "dft/dft.h"
+
+#if defined(HAVE_PREAD) && defined(HAVE_PWRITE)
+
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef HAVE_POSIX_FADVISE
+#  include <fcntl.h>
+#  define ADVISE(fd, ofs, nel, adv) \
+     posix_fadvise(fd, (off_t)(ofs), (off_t)CBYTES(nel), POSIX_FADV_##adv)
+#else
+#  define ADVISE(fd, ofs, nel, adv) 
+#endif
+
+/* bytes occupied by NEL complex numbers */
+#define CBYTES(nel) ((nel) * 2 * (INT)sizeof(R))
+
+/* count each system call as this many "other" operations, so that
+   FFTW_ESTIMATE favors large blocks */
+#define IO_OPS 65536
+
+typedef struct {
+     solver super;
+     size_t maxbuf_ndx;
+} S;
+
+/* in-core budgets, in complex numbers */
+static const INT maxbufs[] = { 
+     (INT)1 << 18, (INT)1 << 20, (INT)1 << 22, (INT)1 << 24 
+};
+
+/* the largest budget allowed under FFTW_CONSERVE_MEMORY */
+#define CONSERVE_MAXBUF ((INT)1 << 20)
+
+typedef struct {
+     plan_dft_ooc super;
+
+     plan *cld0, *cld0rest;	/* rows */
+     plan *cld1, *cld1rest;	/* columns */
+     triggen *t;
+     INT n0, n1, b0, b1, bufsz;
+     int sixstep, sign;
+} P;
+
+/*************************************************************/
+/* I/O */
+
+/* transfer NEL complex numbers between BUF and byte offset OFS of FD.
+   Returns zero on error or premature end of file */
+static int xfer(int fd, R *buf, INT nel, INT ofs, int writep)
+{
+     char *p = (char *) buf;
+     INT nbytes = CBYTES(nel);
+
+     while (nbytes > 0) {
+	  ssize_t k = writep 
+	       ? pwrite(fd, p, (size_t) nbytes, (off_t) ofs)
+	       : pread(fd, p, (size_t) nbytes, (off_t) ofs);
+	  if (k < 0 && errno == EINTR)
+	       continue;
+	  if (k <= 0)
+	       return 0;
+	  p += k; ofs += (INT) k; nbytes -= (INT) k;
+     }
+     return 1;
+}
+
+/* transfer M chunks of B complex numbers, where chunk j is at
+   element j * S of the file and at BUF + 2 * j * B */
+static int xfer_chunks(int fd, INT ofs, R *buf, INT m, INT b, INT s,
+		       int writep)
+{
+     INT j;
+     for (j = 0; j < m; ++j)
+	  if (!xfer(fd, buf + 2 * j * b, b, ofs + CBYTES(j * s), writep))
+	       return 0;
+     return 1;
+}
+
+static void advise_chunks(int fd, INT ofs, INT m, INT b, INT s)
+{
+     INT j;
+     for (j = 0; j < m; ++j)
+	  ADVISE(fd, ofs + CBYTES(j * s), b, WILLNEED);
+     UNUSED(fd); UNUSED(ofs); UNUSED(b); UNUSED(s);
+}
+
+/*************************************************************/
+/* compute */
+
+/* children are forward transforms.  For the backward transform,
+   swap real and imaginary parts, both here and when planning. */
+#define RE(sign) ((sign) == FFT_SIGN ? 0 : 1)
+#define IM(sign) (1 - RE(sign))
+
+static void cldapply(const P *ego, const plan *cld_, R *I, R *O)
+{
+     const plan_dft *cld = (const plan_dft *) cld_;
+     int re = RE(ego->sign), im = IM(ego->sign);
+     cld->apply(cld_, I + re, I + im, O + re, O + im);
+}
+
+/* multiply element (k0, j) of a block of columns C..C+B-1 by
+   omega_n^(k0 * (C + j)) */
+static void twiddle(const P *ego, R *buf, INT c, INT b)
+{
+     triggen *t = ego->t;
+     int re = RE(ego->sign), im = IM(ego->sign);
+     INT k0, j;
+
+     for (k0 = 1; k0 < ego->n0; ++k0) {
+	  for (j = 0; j < b; ++j) {
+	       R *x = buf + 2 * (k0 * b + j), res[2];
+	       t->rotate(t, k0 * (c + j), x[re], x[im], res);
+	       x[re] = res[0]; x[im] = res[1];
+	  }
+     }
+}
+
+/* Each pass returns zero as soon as a transfer fails, leaving the
+   output incomplete. */
+static int rows(const P *ego, int ifd, INT iofs, int ofd, INT oofs, R *buf)
+{
+     INT n0 = ego->n0, n1 = ego->n1, b0 = ego->b0, r, b;
+     R *obuf = ego->sixstep ? buf + 2 * b0 * n1 : buf;
+
+     for (r = 0; r < n0; r += b) {
+	  b = X(imin)(b0, n0 - r);
+	  if (!xfer(ifd, buf, b * n1, iofs + CBYTES(r * n1), 0))
+	       return 0;
+	  if (r + b < n0)
+	       ADVISE(ifd, iofs + CBYTES((r + b) * n1), 
+		      X(imin)(b0, n0 - r - b) * n1, WILLNEED);
+
+	  cldapply(ego, b == b0 ? ego->cld0 : ego->cld0rest, buf, obuf);
+
+	  if (ego->sixstep) {
+	       if (!xfer_chunks(ofd, oofs + CBYTES(r), obuf, n1, b, n0, 1))
+		    return 0;
+	  } else {
+	       if (!xfer(ofd, obuf, b * n1, oofs + CBYTES(r * n1), 1))
+		    return 0;
+	       /* start writeback */
+	       ADVISE(ofd, oofs + CBYTES(r * n1), b * n1, DONTNEED);
+	  }
+     }
+     return 1;
+}
+
+static int columns(const P *ego, int fd, INT ofs, R *buf)
+{
+     INT n0 = ego->n0, n1 = ego->n1, b1 = ego->b1, c, b;
+
+     for (c = 0; c < n1; c += b) {
+	  b = X(imin)(b1, n1 - c);
+	  if (!xfer_chunks(fd, ofs + CBYTES(c), buf, n0, b, n1, 0))
+	       return 0;
+	  if (c + b < n1)
+	       advise_chunks(fd, ofs + CBYTES(c + b), n0, 
+			     X(imin)(b1, n1 - c - b), n1);
+
+	  cldapply(ego, b == b1 ? ego->cld1 : ego->cld1rest, buf, buf);
+	  if (ego->t)
+	       twiddle(ego, buf, c, b);
+
+	  if (!xfer_chunks(fd, ofs + CBYTES(c), buf, n0, b, n1, 1))
+	       return 0;
+     }
+     return 1;
+}
+
+static int apply(const plan *ego_, int ifd, INT iofs, int ofd, INT oofs)
+{
+     const P *ego = (const P *) ego_;
+     R *buf = (R *) MALLOC(sizeof(R) * 2 * ego->bufsz, BUFFERS);
+     int ok;
+
+     if (ego->sixstep)
+	  ok = (columns(ego, ifd, iofs, buf)
+		&& rows(ego, ifd, iofs, ofd, oofs, buf));
+     else
+	  ok = (rows(ego, ifd, iofs, ofd, oofs, buf)
+		&& columns(ego, ofd, oofs, buf));
+
+     X(ifree)(buf);
+     return ok;
+}
+
+/*************************************************************/
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cld0, wakefulness);
+     X(plan_awake)(ego->cld0rest, wakefulness);
+     X(plan_awake)(ego->cld1, wakefulness);
+     X(plan_awake)(ego->cld1rest, wakefulness);
+
+     if (ego->sixstep) {
+	  switch (wakefulness) {
+	      case SLEEPY:
+		   X(triggen_destroy)(ego->t); ego->t = 0;
+		   break;
+	      default:
+		   ego->t = X(mktriggen)(wakefulness, ego->n0 * ego->n1);
+		   break;
+	  }
+     }
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cld1rest);
+     X(plan_destroy_internal)(ego->cld1);
+     X(plan_destroy_internal)(ego->cld0rest);
+     X(plan_destroy_internal)(ego->cld0);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-ooc%s-%Dx%D/%Dx%D%(%p%)%(%p%)%(%p%)%(%p%))",
+	      ego->sixstep ? "-sixstep" : "",
+	      ego->n0, ego->n1, ego->b0, ego->b1,
+	      ego->cld0, ego->cld0rest, ego->cld1, ego->cld1rest);
+}
+
+/*************************************************************/
+
+/* view the problem as an N0 x N1 row-major matrix, where the columns
+   are transformed over dimensions 0..D-1 and the rows over dimensions
+   D..rnk-1 */
+static int split(const problem_dft_ooc *p, INT maxbuf,
+		 int *d, INT *n0, INT *n1)
+{
+     const tensor *sz = p->sz;
+     int i, j;
+
+     if (sz->rnk == 1) {
+	  INT n = sz->dims[0].n;
+	  for (*n0 = X(isqrt)(n); n % *n0; --*n0)
+	       ;
+	  *n1 = n / *n0;
+	  *d = 1;
+	  /* rows need input and output buffers */
+	  return (*n1 <= maxbuf / 2 && *n0 <= maxbuf);
+     }
+
+     *d = 0;
+     for (i = 1; i < sz->rnk; ++i) {
+	  INT N0 = 1, N1 = 1;
+	  for (j = 0; j < i; ++j) N0 *= sz->dims[j].n;
+	  for (; j < sz->rnk; ++j) N1 *= sz->dims[j].n;
+	  if (N0 <= maxbuf && N1 <= maxbuf 
+	      && (!*d || X(imax)(N0, N1) < X(imax)(*n0, *n1))) {
+	       *d = i; *n0 = N0; *n1 = N1;
+	  }
+     }
+     return *d > 0;
+}
+
+static void blocks(INT maxbuf, INT n0, INT n1, int sixstep, 
+		   INT *b0, INT *b1)
+{
+     *b0 = X(imin)(n0, maxbuf / (n1 * (sixstep ? 2 : 1)));
+     *b1 = X(imin)(n1, maxbuf / n0);
+}
+
+static int applicable0(const S *ego, const problem *p_, const planner *plnr)
+{
+     const problem_dft_ooc *p = (const problem_dft_ooc *) p_;
+     INT n0, n1;
+     int d;
+
+     return (1
+	     && p->sz->rnk >= 1
+	     && split(p, maxbufs[ego->maxbuf_ndx], &d, &n0, &n1)
+
+	     /* the six-step algorithm destroys the input */
+	     && (p->sz->rnk > 1 
+		 || (!NO_DESTROY_INPUTP(plnr)
+		     && (p->ifd != p->ofd || p->iofs != p->oofs)))
+
+	     && (!CONSERVE_MEMORYP(plnr) 
+		 || maxbufs[ego->maxbuf_ndx] <= CONSERVE_MAXBUF)
+	  );
+}
+
+/* TRUE if a solver with a smaller budget yields the same blocks */
+static int redundant(const S *ego, const problem_dft_ooc *p)
+{
+     INT n0, n1, b0, b1, c0, c1;
+     int d, sixstep = (p->sz->rnk == 1);
+     size_t i;
+
+     split(p, maxbufs[ego->maxbuf_ndx], &d, &n0, &n1);
+     blocks(maxbufs[ego->maxbuf_ndx], n0, n1, sixstep, &b0, &b1);
+
+     for (i = 0; i < ego->maxbuf_ndx; ++i) {
+	  if (split(p, maxbufs[i], &d, &n0, &n1)) {
+	       blocks(maxbufs[i], n0, n1, sixstep, &c0, &c1);
+	       if (b0 == c0 && b1 == c1)
+		    return 1;
+	  }
+     }
+     return 0;
+}
+
+static int applicable(const S *ego, const problem *p_, const planner *plnr)
+{
+     return applicable0(ego, p_, plnr) 
+	  && !redundant(ego, (const problem_dft_ooc *) p_);
+}
+
+/* dimensions LO..HI-1 of SZ, row major, in complex numbers times S */
+static tensor *mkdims(const tensor *sz, int lo, int hi, INT s)
+{
+     tensor *t = X(mktensor)(hi - lo);
+     int i;
+     for (i = hi - 1; i >= lo; --i) {
+	  t->dims[i - lo].n = sz->dims[i].n;
+	  t->dims[i - lo].is = t->dims[i - lo].os = 2 * s;
+	  s *= sz->dims[i].n;
+     }
+     return t;
+}
+
+/* B rows of length N1 */
+static plan *mkcld0(planner *plnr, const problem_dft_ooc *p, int d,
+		    INT n1, INT b, int sixstep, R *buf, R *obuf)
+{
+     int re = RE(p->sign), im = IM(p->sign);
+     problem *cldp;
+
+     if (sixstep) 
+	  cldp = X(mkproblem_dft_d)(X(mktensor_1d)(n1, 2, 2 * b),
+				    X(mktensor_1d)(b, 2 * n1, 2),
+				    buf + re, buf + im, obuf + re, obuf + im);
+     else
+	  cldp = X(mkproblem_dft_d)(mkdims(p->sz, d, p->sz->rnk, 1),
+				    X(mktensor_1d)(b, 2 * n1, 2 * n1),
+				    buf + re, buf + im, obuf + re, obuf + im);
+
+     return X(mkplan_f_d)(plnr, cldp, 0, 0, NO_DESTROY_INPUT);
+}
+
+/* B columns of length N0 */
+static plan *mkcld1(planner *plnr, const problem_dft_ooc *p, int d,
+		    INT n0, INT b, int sixstep, R *buf)
+{
+     int re = RE(p->sign), im = IM(p->sign);
+     tensor *sz = sixstep 
+	  ? X(mktensor_1d)(n0, 2 * b, 2 * b) 
+	  : mkdims(p->sz, 0, d, b);
+     return X(mkplan_f_d)(plnr, 
+			  X(mkproblem_dft_d)(sz, X(mktensor_1d)(b, 2, 2),
+					     buf + re, buf + im, 
+					     buf + re, buf + im),
+			  0, 0, NO_DESTROY_INPUT);
+}
+
+/* time one block of each pass, with a cold cache, and extrapolate
+   into *T.  Writes are assumed to cost as much as reads.  Returns
+   zero if the input cannot be read. */
+static int measure(const P *pln, const problem_dft_ooc *p, 
+		   const planner *plnr, R *buf, double *t)
+{
+     INT n0 = pln->n0, n1 = pln->n1, b0 = pln->b0, b1 = pln->b1, i;
+     double trow, tcol;
+     crude_time t0;
+
+     for (i = 0; i < 2 * pln->bufsz; ++i)
+	  buf[i] = K(0.0);
+
+     ADVISE(p->ifd, p->iofs, b0 * n1, DONTNEED);
+     t0 = X(get_crude_time)();
+     if (!xfer(p->ifd, buf, b0 * n1, p->iofs, 0))
+	  return 0;
+     trow = 2.0 * X(elapsed_since)(plnr, &p->super, t0);
+     t0 = X(get_crude_time)();
+     cldapply(pln, pln->cld0, buf, pln->sixstep ? buf + 2 * b0 * n1 : buf);
+     trow += X(elapsed_since)(plnr, &p->super, t0);
+
+     for (i = 0; i < n0; ++i)
+	  ADVISE(p->ifd, p->iofs + CBYTES(i * n1), b1, DONTNEED);
+     t0 = X(get_crude_time)();
+     if (!xfer_chunks(p->ifd, p->iofs, buf, n0, b1, n1, 0))
+	  return 0;
+     tcol = 2.0 * X(elapsed_since)(plnr, &p->super, t0);
+     t0 = X(get_crude_time)();
+     cldapply(pln, pln->cld1, buf, buf);
+     tcol += X(elapsed_since)(plnr, &p->super, t0);
+
+     *t = ((double)n0 / b0) * trow + ((double)n1 / b1) * tcol;
+
+     /* never return zero, which would make the planner time the
+	whole transform */
+     if (*t <= 0.0) 
+	  *t = 1e-9;
+     return 1;
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_dft_ooc *p = (const problem_dft_ooc *) p_;
+     P *pln;
+     plan *cld0 = 0, *cld0rest = 0, *cld1 = 0, *cld1rest = 0;
+     R *buf = 0, *obuf;
+     INT n0, n1, b0, b1, bufsz, maxbuf;
+     int d, sixstep;
+
+     static const plan_adt padt = {
+	  X(dft_ooc_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_, plnr))
+	  return (plan *) 0;
+
+     maxbuf = maxbufs[ego->maxbuf_ndx];
+     split(p, maxbuf, &d, &n0, &n1);
+     sixstep = (p->sz->rnk == 1);
+     blocks(maxbuf, n0, n1, sixstep, &b0, &b1);
+     bufsz = X(imax)(b0 * n1 * (sixstep ? 2 : 1), n0 * b1);
+
+     /* initial allocation for the purpose of planning */
+     buf = (R *) MALLOC(sizeof(R) * 2 * bufsz, BUFFERS);
+
+     obuf = sixstep ? buf + 2 * b0 * n1 : buf;
+     cld0 = mkcld0(plnr, p, d, n1, b0, sixstep, buf, obuf);
+     if (!cld0) goto nada;
+     cld0rest = mkcld0(plnr, p, d, n1, n0 % b0, sixstep, buf, obuf);
+     if (!cld0rest) goto nada;
+     cld1 = mkcld1(plnr, p, d, n0, b1, sixstep, buf);
+     if (!cld1) goto nada;
+     cld1rest = mkcld1(plnr, p, d, n0, n1 % b1, sixstep, buf);
+     if (!cld1rest) goto nada;
+
+     pln = MKPLAN_DFT_OOC(P, &padt, apply);
+     pln->cld0 = cld0;
+     pln->cld0rest = cld0rest;
+     pln->cld1 = cld1;
+     pln->cld1rest = cld1rest;
+     pln->t = 0;
+     pln->n0 = n0;
+     pln->n1 = n1;
+     pln->b0 = b0;
+     pln->b1 = b1;
+     pln->bufsz = bufsz;
+     pln->sixstep = sixstep;
+     pln->sign = p->sign;
+
+     {
+	  opcnt *ops = &pln->super.super.ops;
+	  INT nio = (n0 / b0 + 1) * (sixstep ? n1 + 1 : 2) 
+	       + 2 * (n1 / b1 + 1) * n0;
+	  X(ops_zero)(ops);
+	  X(ops_madd2)(n0 / b0, &cld0->ops, ops);
+	  X(ops_add2)(&cld0rest->ops, ops);
+	  X(ops_madd2)(n1 / b1, &cld1->ops, ops);
+	  X(ops_add2)(&cld1rest->ops, ops);
+	  if (sixstep) {
+	       ops->mul += 4 * n0 * n1;
+	       ops->add += 2 * n0 * n1;
+	  }
+	  ops->other += IO_OPS * (double) nio;
+     }
+
+     if (!ESTIMATEP(plnr)) {
+	  int ok;
+	  X(plan_awake)(&pln->super.super, AWAKE_ZERO);
+	  ok = measure(pln, p, plnr, buf, &pln->super.super.pcost);
+	  X(plan_awake)(&pln->super.super, SLEEPY);
+	  if (!ok) {
+	       /* as in apply(), a failed read is reported, here by
+		  returning no plan */
+	       X(ifree)(buf);
+	       X(plan_destroy_internal)(&pln->super.super);
+	       return (plan *) 0;
+	  }
+     }
+
+     /* deallocate buffers, let apply() allocate them for real */
+     X(ifree)(buf);
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(buf);
+     X(plan_destroy_internal)(cld1rest);
+     X(plan_destroy_internal)(cld1);
+     X(plan_destroy_internal)(cld0rest);
+     X(plan_destroy_internal)(cld0);
+     return (plan *) 0;
+}
+
+static solver *mksolver(size_t maxbuf_ndx)
+{
+     static const solver_adt sadt = { PROBLEM_DFT_OOC, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->maxbuf_ndx = maxbuf_ndx;
+     return &(slv->super);
+}
+
+void X(dft_ooc_register)(planner *p)
+{
+     size_t i;
+     for (i = 0; i < NELEM(maxbufs); ++i)
+	  REGISTER_SOLVER(p, mksolver(i));
+}
+
+#else /* !(HAVE_PREAD && HAVE_PWRITE) */
+
+void X(dft_ooc_register)(planner *p)
+{
+     UNUSED(p);
+}
+
+#endif
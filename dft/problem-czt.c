@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "dft/dft.h"
+
+static void destroy(problem *ego_)
+{
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_czt *p = (const problem_czt *) p_;
+     X(md5puts)(m, "czt");
+     X(md5int)(m, p->ri == p->ro);
+     X(md5INT)(m, p->ii - p->ri);
+     X(md5INT)(m, p->io - p->ro);
+     X(md5INT)(m, p->n);
+     X(md5INT)(m, p->m);
+     X(md5INT)(m, p->is);
+     X(md5INT)(m, p->os);
+     X(md5putb)(m, &p->f0, sizeof(p->f0));
+     X(md5putb)(m, &p->df, sizeof(p->df));
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_czt *ego = (const problem_czt *) ego_;
+     p->print(p, "(czt %d %D %D %D %D %D %D)", 
+	      ego->ri == ego->ro,
+	      (INT)(ego->ii - ego->ri), 
+	      (INT)(ego->io - ego->ro),
+	      ego->n, ego->m, ego->is, ego->os);
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_czt *ego = (const problem_czt *) ego_;
+     R *ri = UNTAINT(ego->ri), *ii = UNTAINT(ego->ii);
+     INT i;
+
+     for (i = 0; i < ego->n; ++i) 
+	  ri[i * ego->is] = ii[i * ego->is] = K(0.0);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_CZT,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_czt)(INT n, INT m, INT is, INT os,
+			  R *ri, R *ii, R *ro, R *io,
+			  double f0, double df)
+{
+     problem_czt *ego;
+
+     /* enforce pointer equality if untainted pointers are equal */
+     if (UNTAINT(ri) == UNTAINT(ro))
+	  ri = ro = JOIN_TAINT(ri, ro);
+     if (UNTAINT(ii) == UNTAINT(io))
+	  ii = io = JOIN_TAINT(ii, io);
+
+     A(n > 0 && m > 0);
+
+     if ((ri == ro) != (ii == io))
+	  return X(mkproblem_unsolvable)();
+
+     ego = (problem_czt *)X(mkproblem)(sizeof(problem_czt), &padt);
+
+     ego->n = n;
+     ego->m = m;
+     ego->is = is;
+     ego->os = os;
+     ego->ri = ri;
+     ego->ii = ii;
+     ego->ro = ro;
+     ego->io = io;
+     ego->f0 = f0;
+     ego->df = df;
+
+     return &(ego->super);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "dft/dft.h"
+#include <math.h>
+
+static void destroy(problem *ego_)
+{
+     problem_nufft *ego = (problem_nufft *) ego_;
+     X(tensor_destroy)(ego->sz);
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_nufft *p = (const problem_nufft *) p_;
+     X(md5puts)(m, "nufft");
+     X(md5int)(m, p->type);
+     X(tensor_md5)(m, p->sz);
+     X(md5INT)(m, p->m);
+     X(md5int)(m, p->sign);
+     X(md5int)(m, p->w);
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_nufft *ego = (const problem_nufft *) ego_;
+     p->print(p, "(nufft%d %T %D %d %d)", 
+	      ego->type, ego->sz, ego->m, ego->sign, ego->w);
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_nufft *ego = (const problem_nufft *) ego_;
+     R *in = (ego->type == 1) ? ego->c : ego->f;
+     INT i, n = (ego->type == 1) ? ego->m : X(tensor_sz)(ego->sz);
+
+     /* the coordinates belong to the user and are left alone; the
+	solvers cope with whatever they contain */
+     for (i = 0; i < 2 * n; ++i) 
+	  in[i] = K(0.0);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_NUFFT,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+/* spreading width for a relative tolerance EPS, for an
+   oversampling factor of 2 */
+static int width(double eps)
+{
+     double w = (eps > 0.0) ? ceil(-log10(eps)) + 1.0 : 16.0;
+     return (int) ((w < 2.0) ? 2.0 : (w > 16.0) ? 16.0 : w);
+}
+
+problem *X(mkproblem_nufft)(int type, int rnk, const INT *n, INT m,
+			    R *x, R *c, R *f, int sign, double eps)
+{
+     problem_nufft *ego;
+     INT s;
+     int i;
+
+     A(type == 1 || type == 2);
+     A(rnk >= 1 && rnk <= 3);
+     A(m >= 0);
+     A(sign == -1 || sign == 1);
+
+     ego = (problem_nufft *)X(mkproblem)(sizeof(problem_nufft), &padt);
+
+     ego->sz = X(mktensor)(rnk);
+     for (i = rnk - 1, s = 1; i >= 0; --i) {
+	  A(n[i] > 0);
+	  ego->sz->dims[i].n = n[i];
+	  ego->sz->dims[i].is = ego->sz->dims[i].os = s;
+	  s *= n[i];
+     }
+     ego->type = type;
+     ego->m = m;
+     ego->x = x;
+     ego->c = c;
+     ego->f = f;
+     ego->sign = sign;
+     ego->w = width(eps);
+
+     return &(ego->super);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "dft/dft.h"
+
+static void destroy(problem *ego_)
+{
+     problem_dft_ooc *ego = (problem_dft_ooc *) ego_;
+     X(tensor_destroy)(ego->sz);
+     X(ifree)(ego_);
+}
+
+static int inplacep(const problem_dft_ooc *p)
+{
+     return p->ifd == p->ofd && p->iofs == p->oofs;
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_dft_ooc *p = (const problem_dft_ooc *) p_;
+     X(md5puts)(m, "dft-ooc");
+     /* don't include the file descriptors or offsets, which are
+	arbitrary and may differ between runs.  Only in-placeness
+	matters for applicability. */
+     X(md5int)(m, inplacep(p));
+     X(tensor_md5)(m, p->sz);
+     X(md5int)(m, p->sign);
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_dft_ooc *ego = (const problem_dft_ooc *) ego_;
+     p->print(p, "(dft-ooc %d %T %d)", inplacep(ego), ego->sz, ego->sign);
+}
+
+static void zero(const problem *ego_)
+{
+     /* never touch the user's files; out-of-core plans
+	report their own pcost and are not timed by the planner */
+     UNUSED(ego_);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_DFT_OOC,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_dft_ooc)(int rnk, const INT *n,
+			      int ifd, INT iofs, int ofd, INT oofs,
+			      int sign)
+{
+     problem_dft_ooc *ego;
+     INT s;
+     int i;
+
+     A(FINITE_RNK(rnk) && rnk >= 0);
+     A(sign == -1 || sign == 1);
+
+     if (ifd < 0 || ofd < 0 || iofs < 0 || oofs < 0)
+	  return X(mkproblem_unsolvable)();
+
+     ego = (problem_dft_ooc *)X(mkproblem)(sizeof(problem_dft_ooc), &padt);
+
+     ego->sz = X(mktensor)(rnk);
+     for (i = rnk - 1, s = 1; i >= 0; --i) {
+	  A(n[i] > 0);
+	  ego->sz->dims[i].n = n[i];
+	  ego->sz->dims[i].is = ego->sz->dims[i].os = s;
+	  s *= n[i];
+     }
+     ego->ifd = ifd;
+     ego->iofs = iofs;
+     ego->ofd = ofd;
+     ego->oofs = oofs;
+     ego->sign = sign;
+
+     return &(ego->super);
+}
@@ -74,6 +74,33 @@ Q1F = q1fv_2.c q1fv_4.c q1fv_5.c q1fv_8.c
 # as above, but FFTW_BACKWARD
 Q1B = q1bv_2.c q1bv_4.c q1bv_5.c q1bv_8.c
 
+###########################################################################
+# n1fvr32_<n>, t1fvr32_<r>, ... are the large codelets scheduled for
+# 32 vector registers (genfft -registers 32).  The default ones are
+# scheduled without regard to the register count, which suits
+# 16-register machines.  The R32 codelets are only built for the ISAs
+# with 32 vector registers (avx512, kcvi, generic-simd512), whose
+# Makefile.am sets EXTRA_CODELETS = $(R32) and defines
+# SIMD_R32_CODELETS, and are registered there after the default ones.
+# Both have the same operation counts, so FFTW_ESTIMATE keeps the
+# default codelet; only measuring planners choose between them.
+R32 = n1fvr32_32.c n1fvr32_64.c n1bvr32_32.c n1bvr32_64.c		\
+t1fvr32_32.c t1fvr32_64.c t1bvr32_32.c t1bvr32_64.c
+
+###########################################################################
+# Large codelets, built and registered only with --enable-large-codelets
+# (ENABLE_LARGE_CODELETS in CMake): n=256 no-twiddle codelets, and the
+# radix-64 variants of the log3 twiddle codelets
+LARGE_SIMD_CODELETS = n1fv_256.c n1bv_256.c t3fv_64.c t3bv_64.c
+
+###########################################################################
+# Hand-written solvers, compiled for each SIMD extension and registered
+# along with the codelets: genericv is the O(n^2) DFT for prime sizes
+# without a codelet, dftw_genericv the twiddle multiplication of
+# generic-radix Cooley-Tukey steps, and transposev the rank-0 transposes
+# of complex arrays
+SIMD_SOLVERS = genericv.c dftw_genericv.c transposev.c
+
 ###########################################################################
 SIMD_CODELETS = $(N1F) $(N1B) $(N2F) $(N2B) $(N2S) $(T1FU) $(T1F)	\
 $(T2F) $(T3F) $(T1BU) $(T1B) $(T2B) $(T3B) $(T1S) $(T2S) $(Q1F) $(Q1B)
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* O(n^2) DFT of odd prime size, as in dft/generic.c, but computing
+   VL transforms of the vector loop at once */
+
+#include "dft/dft.h"
+#include SIMD_HEADER
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+     R *c; /* (cos, cos) and (sin, sin) pairs of the N roots of
+	      unity, loaded with stride 0 */
+     INT n, is, os;
+     INT vl, ivs, ovs;
+     int bwd; /* imaginary parts precede real parts in memory */
+} P;
+
+/* loads and stores of the first NV lanes.  NV < VL only happens for
+   the last block of the vector loop, on ISAs with masked tails. */
+static inline V LDV(const R *x, INT ivs, const R *aligned_like, INT nv)
+{
+#ifdef SIMD_MASKED_TAIL
+     if (nv < VL)
+	  return LDt(x, ivs, aligned_like, nv);
+#endif
+     UNUSED(nv);
+     return LD(x, ivs, aligned_like);
+}
+
+static inline void STV(R *x, V v, INT ovs, const R *aligned_like, INT nv)
+{
+#ifdef SIMD_MASKED_TAIL
+     if (nv < VL) {
+	  STt(x, v, ovs, aligned_like, nv);
+	  return;
+     }
+#endif
+     UNUSED(nv);
+     ST(x, v, ovs, aligned_like);
+}
+
+/* NV transforms, NV <= VL */
+static inline void block(const P *ego, const R *x, R *y, R *buf, INT nv)
+{
+     INT n = ego->n, h = (n - 1) / 2, is = ego->is, os = ego->os;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     INT i, k;
+     V x0 = LDV(x, ivs, x, nv), y0 = x0;
+
+     /* sums and differences of inputs I and N - I */
+     for (i = 1; i <= h; ++i) {
+	  V a = LDV(x + i * is, ivs, x, nv);
+	  V b = LDV(x + (n - i) * is, ivs, x, nv);
+	  V s = VADD(a, b);
+	  y0 = VADD(y0, s);
+	  STA(buf + 4 * VL * (i - 1), s, 2, buf);
+	  STA(buf + 4 * VL * (i - 1) + 2 * VL, VSUB(a, b), 2, buf);
+     }
+     STV(y, y0, ovs, y, nv);
+
+     for (k = 1; k <= h; ++k) {
+	  /* root (i k) mod n, stepping by k */
+	  const R *c0 = ego->c, *c = c0 + 4 * k;
+	  INT j = k;
+	  V re = VFMA(LD(c, 0, c0), LDA(buf, 2, buf), x0);
+	  V im = VMUL(LD(c + 2, 0, c0), LDA(buf + 2 * VL, 2, buf));
+
+	  for (i = 1; i < h; ++i) {
+	       const R *b = buf + 4 * VL * i;
+	       j += k; if (j >= n) j -= n;
+	       c = c0 + 4 * j;
+	       re = VFMA(LD(c, 0, c0), LDA(b, 2, buf), re);
+	       im = VFMA(LD(c + 2, 0, c0), LDA(b + 2 * VL, 2, buf), im);
+	  }
+
+	  if (ego->bwd) {
+	       STV(y + k * os, VFMAI(im, re), ovs, y, nv);
+	       STV(y + (n - k) * os, VFNMSI(im, re), ovs, y, nv);
+	  } else {
+	       STV(y + k * os, VFNMSI(im, re), ovs, y, nv);
+	       STV(y + (n - k) * os, VFMAI(im, re), ovs, y, nv);
+	  }
+     }
+}
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT h = (ego->n - 1) / 2, vl = ego->vl;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     INT v;
+     const R *x = ego->bwd ? ii : ri;
+     R *y = ego->bwd ? io : ro;
+     R *buf;
+     size_t bufsz = 4 * VL * h * sizeof(R);
+
+     BUF_ALLOC(R *, buf, bufsz);
+
+     for (v = 0; v + VL <= vl; v += VL, x += VL * ivs, y += VL * ovs)
+	  block(ego, x, y, buf, VL);
+     if (v < vl)
+	  block(ego, x, y, buf, vl - v);
+     VLEAVE();
+
+     BUF_FREE(buf, bufsz);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     switch (wakefulness) {
+	 case SLEEPY:
+	      X(ifree0)(ego->c); ego->c = 0;
+	      break;
+	 default: {
+	      INT n = ego->n, j;
+	      triggen *t = X(mktriggen)(wakefulness, n);
+	      R *c;
+
+	      A(!ego->c);
+	      ego->c = c = (R *) MALLOC(4 * n * sizeof(R), TWIDDLES);
+	      for (j = 0; j < n; ++j, c += 4) {
+		   R w[2];
+		   t->cexp(t, j, w);
+		   c[0] = c[1] = w[0];
+		   c[2] = c[3] = w[1];
+	      }
+	      X(triggen_destroy)(t);
+	      break;
+	 }
+     }
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+
+     p->print(p, "(%s-%D%v)", XSIMD_STRING("dft-genericv"), ego->n, ego->vl);
+}
+
+static int applicable(const problem *p_, const planner *plnr,
+		      INT *vl, INT *ivs, INT *ovs)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     const R *x, *y;
+     INT n;
+
+     if (!(1
+	   && p->sz->rnk == 1
+	   && p->vecsz->rnk <= 1
+	   && X(tensor_tornk1)(p->vecsz, vl, ivs, ovs)
+	  ))
+	  return 0;
+
+     n = p->sz->dims[0].n;
+     x = p->ri < p->ii ? p->ri : p->ii;
+     y = p->ro < p->io ? p->ro : p->io;
+
+     return (1
+	     && !NO_SIMDP(plnr)
+	     && (n % 2) == 1
+	     && CIMPLIES(NO_LARGE_GENERICP(plnr), n < GENERIC_MIN_BAD)
+	     && CIMPLIES(NO_SLOWP(plnr), n > GENERIC_MAX_SLOW)
+	     && X(is_prime)(n)
+#ifndef SIMD_MASKED_TAIL
+	     && (*vl % VL) == 0
+#endif
+
+	     /* interleaved, in the same order on input and output */
+	     && ((p->ii == p->ri + 1 && p->io == p->ro + 1)
+		 || (p->ri == p->ii + 1 && p->ro == p->io + 1))
+
+	     && ALIGNED(x)
+	     && ALIGNED(y)
+	     && SIMD_STRIDE_OK(p->sz->dims[0].is)
+	     && SIMD_STRIDE_OK(p->sz->dims[0].os)
+	     && SIMD_VSTRIDE_OK(*ivs)
+	     && SIMD_VSTRIDE_OK(*ovs)
+
+	     /* each block of VL transforms is read before it is written */
+	     && (p->ri != p->ro || X(tensor_inplace_strides2)(p->sz, p->vecsz))
+	  );
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln;
+     INT n, vl, ivs, ovs;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, X(plan_null_destroy)
+     };
+
+     UNUSED(ego);
+     if (!applicable(p_, plnr, &vl, &ivs, &ovs))
+          return (plan *)0;
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+
+     pln->n = n = p->sz->dims[0].n;
+     pln->is = p->sz->dims[0].is;
+     pln->os = p->sz->dims[0].os;
+     pln->vl = vl;
+     pln->ivs = ivs;
+     pln->ovs = ovs;
+     pln->bwd = (p->ri == p->ii + 1);
+     pln->c = 0;
+
+     /* in units of SIMD vectors, like the codelets; a partial last
+	vector costs as much as a full one */
+     {
+	  INT nv = (vl + VL - 1) / VL;
+	  pln->super.super.ops.add = nv * (n - 1) * 3;
+	  pln->super.super.ops.mul = nv * (n - 1) / 2;
+	  pln->super.super.ops.fma = nv * (n - 1) * (n - 1) / 2;
+     }
+
+     return &(pln->super.super);
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+/* registered through codlist.c, hence the codelet-style name */
+void XSIMD(codelet_genericv)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
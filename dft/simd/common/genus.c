@@ -38,7 +38,9 @@ static int n1b_okp(const kdft_desc *d,
 	     && SIMD_VSTRIDE_OK(ovs)
              && ri == ii + 1
              && ro == io + 1
+#ifndef SIMD_MASKED_TAIL
              && (vl % VL) == 0
+#endif
              && (!d->is || (d->is == is))
              && (!d->os || (d->os == os))
              && (!d->ivs || (d->ivs == ivs))
@@ -63,7 +65,9 @@ static int n1f_okp(const kdft_desc *d,
 	     && SIMD_VSTRIDE_OK(ovs)
              && ii == ri + 1
              && io == ro + 1
+#ifndef SIMD_MASKED_TAIL
              && (vl % VL) == 0
+#endif
              && (!d->is || (d->is == is))
              && (!d->os || (d->os == os))
              && (!d->ivs || (d->ivs == ivs))
@@ -88,7 +92,9 @@ static int n2b_okp(const kdft_desc *d,
 	     && SIMD_STRIDE_OKPAIR(ovs)
              && ri == ii + 1
              && ro == io + 1
+#ifndef SIMD_MASKED_TAIL
              && (vl % VL) == 0
+#endif
              && (!d->is || (d->is == is))
              && (!d->os || (d->os == os))
              && (!d->ivs || (d->ivs == ivs))
@@ -113,7 +119,9 @@ static int n2f_okp(const kdft_desc *d,
 	     && SIMD_STRIDE_OKPAIR(ovs)
              && ii == ri + 1
              && io == ro + 1
+#ifndef SIMD_MASKED_TAIL
              && (vl % VL) == 0
+#endif
              && (!d->is || (d->is == is))
              && (!d->os || (d->os == os))
              && (!d->ivs || (d->ivs == ivs))
@@ -202,9 +210,13 @@ static int t_okp_common(const ct_desc *d,
 	     && !NO_SIMDP(plnr)
 	     && SIMD_STRIDE_OKA(rs)
 	     && SIMD_VSTRIDE_OKA(ms)
+#ifndef SIMD_MASKED_TAIL
 	     && (m % VL) == 0
+#endif
 	     && (mb % VL) == 0
+#ifndef SIMD_MASKED_TAIL
 	     && (me % VL) == 0
+#endif
 	     && (!d->rs || (d->rs == rs))
 	     && (!d->vs || (d->vs == vs))
 	     && (!d->ms || (d->ms == ms))
@@ -222,7 +234,9 @@ static int t_okp_commonu(const ct_desc *d,
 	     && SIMD_STRIDE_OK(rs)
 	     && SIMD_VSTRIDE_OK(ms)
 	     && (mb % VL) == 0
+#ifndef SIMD_MASKED_TAIL
 	     && (me % VL) == 0
+#endif
 	     && (!d->rs || (d->rs == rs))
 	     && (!d->vs || (d->vs == vs))
 	     && (!d->ms || (d->ms == ms))
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* rank-0 DFTs that transpose a two-dimensional array of complex
+   numbers, as kernel/cpy2d.c and kernel/transpose.c do for any
+   element size, but moving VL complex numbers per load and store:
+   each vector is read along the dimension that is contiguous on
+   input, and pairs of vectors are written back with STM2/STN2 along
+   the dimension that is contiguous on output. */
+
+#include "dft/dft.h"
+#include SIMD_HEADER
+
+/* the transposes proceed by tiles of TILE (even) rows or columns,
+   so that the cache lines of a tile are reused by consecutive vectors */
+#define TILE 32
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_dft super;
+     INT n0, s0; /* input stride 2, output stride s0 */
+     INT n1, s1; /* input stride s1, output stride 2 */
+} P;
+
+/* copy the NV < VL complex numbers at X (stride 2) to Y (stride OVS) */
+static void cpy_tail(const R *x, R *y, INT ovs, INT nv)
+{
+#ifdef SIMD_MASKED_TAIL
+     STt(y, LDt(x, 2, x, nv), ovs, y, nv);
+#else
+     INT k;
+     for (k = 0; k < nv; ++k) {
+	  y[k * ovs] = x[2 * k];
+	  y[k * ovs + 1] = x[2 * k + 1];
+     }
+#endif
+}
+
+static void apply_oop(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT n0 = ego->n0, s0 = ego->s0, n1 = ego->n1, s1 = ego->s1;
+     INT a, b, b0, b1;
+     const R *I = ri < ii ? ri : ii;
+     R *O = ro < io ? ro : io;
+
+     for (b0 = 0; b0 < n1; b0 = b1) {
+	  b1 = b0 + TILE;
+	  if (b1 > n1) b1 = n1;
+
+	  for (a = 0; a + VL <= n0; a += VL) {
+	       const R *x = I + 2 * a;
+	       R *y = O + a * s0;
+
+	       for (b = b0; b + 2 <= b1; b += 2) {
+		    V v0 = LDA(x + b * s1, 2, x);
+		    V v1 = LDA(x + (b + 1) * s1, 2, x);
+		    STM2(y + 2 * b, v0, s0, y);
+		    STM2(y + 2 * b + 2, v1, s0, y);
+		    STN2(y + 2 * b, v0, v1, s0);
+	       }
+	       if (b < b1)
+		    ST(y + 2 * b, LDA(x + b * s1, 2, x), s0, y);
+	  }
+	  if (a < n0)
+	       for (b = b0; b < b1; ++b)
+		    cpy_tail(I + 2 * a + b * s1, O + a * s0 + 2 * b, s0,
+			     n0 - a);
+     }
+     VLEAVE();
+}
+
+static inline void swap(R *x, R *y)
+{
+     R t0 = x[0], t1 = x[1];
+     x[0] = y[0]; x[1] = y[1];
+     y[0] = t0; y[1] = t1;
+}
+
+/* in place, n0 == n1 and s0 == s1: A[r][c] lives at x + r s + 2 c.
+   Rows i .. i+VL-1 swap their columns c >= i+VL with rows c as
+   vectors, TILE columns at a time; the rest is swapped one complex
+   number at a time. */
+static void apply_ip(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     INT n = ego->n0, s = ego->s0;
+     INT nv = n - n % VL;
+     INT i, i0, i1, c, c0, c1, r;
+     R *x = ri < ii ? ri : ii;
+
+     UNUSED(ro);
+     UNUSED(io);
+
+     for (i0 = 0; i0 < nv; i0 = i1) {
+	  i1 = i0 + TILE;
+	  if (i1 > nv) i1 = nv;
+
+	  for (c0 = i0; c0 < n; c0 = c1) {
+	       c1 = c0 + TILE;
+	       if (c1 > n) c1 = n;
+
+	       for (i = i0; i < i1; i += VL) {
+		    R *row = x + 2 * i; /* A[.][i .. i+VL-1] */
+		    R *col = x + i * s; /* A[i .. i+VL-1][.] */
+
+		    if (c0 == i0)
+			 for (r = i; r < i + VL; ++r)
+			      for (c = r + 1; c < i + VL; ++c)
+				   swap(x + r * s + 2 * c, x + c * s + 2 * r);
+
+		    /* both stores of each pair follow both loads */
+		    for (c = (c0 > i + VL ? c0 : i + VL); c + 2 <= c1; c += 2) {
+			 V w0 = LDA(row + c * s, 2, x);
+			 V w1 = LDA(row + (c + 1) * s, 2, x);
+			 V u0 = LD(col + 2 * c, s, x);
+			 V u1 = LD(col + 2 * c + 2, s, x);
+			 STA(row + c * s, u0, 2, x);
+			 STA(row + (c + 1) * s, u1, 2, x);
+			 STM2(col + 2 * c, w0, s, x);
+			 STM2(col + 2 * c + 2, w1, s, x);
+			 STN2(col + 2 * c, w0, w1, s);
+		    }
+		    if (c < c1) {
+			 V w = LDA(row + c * s, 2, x);
+			 V u = LD(col + 2 * c, s, x);
+			 STA(row + c * s, u, 2, x);
+			 ST(col + 2 * c, w, s, x);
+		    }
+	       }
+	  }
+     }
+
+     for (r = nv; r < n; ++r)
+	  for (c = r + 1; c < n; ++c)
+	       swap(x + r * s + 2 * c, x + c * s + 2 * r);
+     VLEAVE();
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+
+     p->print(p, "(%s-%Dx%D)", XSIMD_STRING("dft-transposev"),
+	      ego->n0, ego->n1);
+}
+
+static int applicable(const problem *p_, const planner *plnr, P *pln)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     const iodim *d = p->vecsz->dims;
+     const R *x, *y;
+     int k;
+
+     if (!(1
+	   && p->sz->rnk == 0
+	   && p->vecsz->rnk == 2
+	  ))
+	  return 0;
+
+     if (d[0].is == 2 && d[1].os == 2)
+	  k = 0;
+     else if (d[1].is == 2 && d[0].os == 2)
+	  k = 1;
+     else
+	  return 0;
+
+     pln->n0 = d[k].n;
+     pln->s0 = d[k].os;
+     pln->n1 = d[1 - k].n;
+     pln->s1 = d[1 - k].is;
+
+     x = p->ri < p->ii ? p->ri : p->ii;
+     y = p->ro < p->io ? p->ro : p->io;
+
+     return (1
+	     && !NO_SIMDP(plnr)
+
+	     /* interleaved, in the same order on input and output */
+	     && ((p->ii == p->ri + 1 && p->io == p->ro + 1)
+		 || (p->ri == p->ii + 1 && p->ro == p->io + 1))
+
+	     /* a transpose, not a copy */
+	     && pln->s0 != 2
+	     && pln->s1 != 2
+	     && pln->n0 >= VL
+
+	     && ALIGNEDA(x)
+	     && ALIGNEDA(y)
+	     && SIMD_STRIDE_OKA(pln->s0)
+	     && SIMD_STRIDE_OKA(pln->s1)
+
+	     /* in place, only square transposes */
+	     && (x != y || (pln->n0 == pln->n1 && pln->s0 == pln->s1))
+	  );
+}
+
+static plan *mkplan(const solver *ego, const problem *p_, planner *plnr)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln, tmp;
+
+     static const plan_adt padt = {
+	  X(dft_solve), X(null_awake), print, X(plan_null_destroy)
+     };
+
+     UNUSED(ego);
+     if (!applicable(p_, plnr, &tmp))
+          return (plan *)0;
+
+     pln = MKPLAN_DFT(P, &padt, p->ri == p->ro ? apply_ip : apply_oop);
+     pln->n0 = tmp.n0;
+     pln->s0 = tmp.s0;
+     pln->n1 = tmp.n1;
+     pln->s1 = tmp.s1;
+
+     /* one load and one store per vector, in units of SIMD vectors
+	like the codelets */
+     X(ops_other)(2 * ((tmp.n0 + VL - 1) / VL) * tmp.n1,
+		  &pln->super.super.ops);
+
+     return &(pln->super.super);
+}
+
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+/* registered through codlist.c, hence the codelet-style name */
+void XSIMD(codelet_transposev)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
@@ -20,5 +20,14 @@
 
 #include SIMD_HEADER
 
+#ifdef SIMD_MASKED_TAIL
+/* the last iteration of the loop over the I remaining transforms
+   may have fewer than VL of them */
+#undef LD
+#define LD(x, ivs, al) LDt(x, ivs, al, VTAIL(i))
+#undef ST
+#define ST(x, v, ovs, al) STt(x, v, ovs, al, VTAIL(i))
+#endif
+
 #define GENUS XSIMD(dft_n1fsimd_genus)
 extern const kdft_genus GENUS;
@@ -20,8 +20,17 @@
 
 #include SIMD_HEADER
 
+#ifdef SIMD_MASKED_TAIL
+/* the last iteration of the loop over the I remaining transforms
+   may have fewer than VL of them */
+#undef LD
+#define LD(x, ivs, al) LDAt(x, ivs, al, VTAIL(i))
+#undef ST
+#define ST(x, v, ovs, al) STt(x, v, ovs, al, VTAIL(i))
+#else
 #undef LD
 #define LD LDA
+#endif
 
 #define GENUS XSIMD(dft_n2bsimd_genus)
 extern const kdft_genus GENUS;
@@ -1,5 +1,12 @@
 AM_CPPFLAGS = -I $(top_srcdir)
-EXTRA_DIST = $(SIMD_CODELETS) genus.c codlist.c
+EXTRA_DIST = $(SIMD_CODELETS) $(LARGE_SIMD_CODELETS) $(SIMD_SOLVERS)	\
+$(EXTRA_CODELETS) genus.c codlist.c
+
+SIMD_SOURCES = $(SIMD_CODELETS) $(EXTRA_CODELETS) $(SIMD_SOLVERS)	\
+genus.c codlist.c
+if HAVE_LARGE_CODELETS
+SIMD_SOURCES += $(LARGE_SIMD_CODELETS)
+endif
 
 if MAINTAINER_MODE
 $(EXTRA_DIST): Makefile
@@ -20,6 +20,15 @@
 
 #include SIMD_HEADER
 
+#ifdef SIMD_MASKED_TAIL
+/* the last iteration of the loop over [mb, me) may have fewer
+   than VL columns left */
+#undef LD
+#define LD(x, ivs, al) LDt(x, ivs, al, VTAIL(me - m))
+#undef ST
+#define ST(x, v, ovs, al) STt(x, v, ovs, al, VTAIL(me - m))
+#endif
+
 #define VTW VTW1
 #define TWVL TWVL1
 #define BYTW BYTW1
@@ -20,10 +20,19 @@
 
 #include SIMD_HEADER
 
+#ifdef SIMD_MASKED_TAIL
+/* the last iteration of the loop over [mb, me) may have fewer
+   than VL columns left */
+#undef LD
+#define LD(x, ivs, al) LDAt(x, ivs, al, VTAIL(me - m))
+#undef ST
+#define ST(x, v, ovs, al) STAt(x, v, ovs, al, VTAIL(me - m))
+#else
 #undef LD
 #define LD LDA
 #undef ST
 #define ST STA
+#endif
 
 #define VTW VTW3
 #define TWVL TWVL3
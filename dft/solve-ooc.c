@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "dft/dft.h"
+
+/* use the apply() operation for DFT_OOC problems */
+/* X(execute) has no way to report an I/O error; X(execute_dft_ooc)
+   does */
+void X(dft_ooc_solve)(const plan *ego_, const problem *p_)
+{
+     const plan_dft_ooc *ego = (const plan_dft_ooc *) ego_;
+     const problem_dft_ooc *p = (const problem_dft_ooc *) p_;
+     (void) ego->apply(ego_, p->ifd, p->iofs, p->ofd, p->oofs);
+}
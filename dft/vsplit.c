@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Split the vector loop of a batch of small 1d DFTs into a part whose
+   length is a multiple of Q and a tail of fewer than Q transforms.
+
+   The SIMD codelets (n1fv, n1bv) compute VL transforms of the vector
+   loop at once, one per SIMD lane, but require the vector length to
+   be a multiple of VL.  For interleaved channels (vector stride
+   smaller than the transform stride) with a channel count that is
+   not a multiple of VL, no SIMD codelet applies to the whole loop,
+   and the whole batch would fall back to scalar code.  Splitting off
+   the tail lets the SIMD codelets handle all but the last few
+   channels.  Q ranges over the SIMD widths we support, from SSE2
+   single precision up to AVX-512. */
+
+#include "dft/dft.h"
+
+/* without SIMD codelets, the split only adds overhead */
+#if HAVE_SIMD
+
+typedef struct {
+     solver super;
+     size_t q_ndx;
+} S;
+
+static const INT qs[] = { 2, 4, 8, 16 };
+
+typedef struct {
+     plan_dft super;
+
+     plan *cld, *cldrest;
+     INT vl, q, ivs_by_vl0, ovs_by_vl0;
+} P;
+
+static void apply(const plan *ego_, R *ri, R *ii, R *ro, R *io)
+{
+     const P *ego = (const P *) ego_;
+     plan_dft *cld = (plan_dft *) ego->cld;
+     plan_dft *cldrest = (plan_dft *) ego->cldrest;
+     INT id = ego->ivs_by_vl0, od = ego->ovs_by_vl0;
+
+     cld->apply((plan *) cld, ri, ii, ro, io);
+     cldrest->apply((plan *) cldrest, ri + id, ii + id, ro + od, io + od);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(dft-vsplit-%D/%D%(%p%)%(%p%))",
+	      ego->vl, ego->q, ego->cld, ego->cldrest);
+}
+
+static int redundant(INT vl, size_t which)
+{
+     size_t i;
+     for (i = 0; i < which; ++i)
+	  if (vl - vl % qs[i] == vl - vl % qs[which])
+	       return 1;
+     return 0;
+}
+
+static int applicable(const S *ego, const problem *p_, const planner *plnr)
+{
+     const problem_dft *p = (const problem_dft *) p_;
+     const iodim *d = p->sz->dims, *v = p->vecsz->dims;
+     INT q = qs[ego->q_ndx];
+
+     return (1
+	     && !NO_SIMDP(plnr)
+	     && p->sz->rnk == 1
+	     && p->vecsz->rnk == 1
+	     && v[0].n > q
+	     && v[0].n % q != 0
+	     && !redundant(v[0].n, ego->q_ndx)
+
+	     /* only for interleaved batches, where the vector loop is
+		the innermost one; otherwise vrank-geq1 does as well */
+	     && X(iabs)(v[0].is) < X(iabs)(d[0].is)
+	     && X(iabs)(v[0].os) < X(iabs)(d[0].os)
+
+	     /* in place, the two halves must not overlap */
+	     && (p->ri != p->ro
+		 || X(tensor_inplace_strides2)(p->sz, p->vecsz))
+	  );
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_dft *p = (const problem_dft *) p_;
+     P *pln;
+     plan *cld = 0, *cldrest = 0;
+     INT vl, vl0, ivs, ovs, q;
+
+     static const plan_adt padt = {
+	  X(dft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_, plnr))
+	  return (plan *) 0;
+
+     q = qs[ego->q_ndx];
+     X(tensor_tornk1)(p->vecsz, &vl, &ivs, &ovs);
+     vl0 = vl - vl % q;
+
+     cld = X(mkplan_d)(plnr,
+		       X(mkproblem_dft_d)(X(tensor_copy)(p->sz),
+					  X(mktensor_1d)(vl0, ivs, ovs),
+					  p->ri, p->ii, p->ro, p->io));
+     if (!cld)
+	  goto nada;
+
+     cldrest = X(mkplan_d)(plnr,
+			   X(mkproblem_dft_d)(
+				X(tensor_copy)(p->sz),
+				X(mktensor_1d)(vl - vl0, ivs, ovs),
+				p->ri + ivs * vl0, p->ii + ivs * vl0,
+				p->ro + ovs * vl0, p->io + ovs * vl0));
+     if (!cldrest)
+	  goto nada;
+
+     pln = MKPLAN_DFT(P, &padt, apply);
+     pln->cld = cld;
+     pln->cldrest = cldrest;
+     pln->vl = vl;
+     pln->q = q;
+     pln->ivs_by_vl0 = ivs * vl0;
+     pln->ovs_by_vl0 = ovs * vl0;
+
+     X(ops_add)(&cld->ops, &cldrest->ops, &pln->super.super.ops);
+     return &(pln->super.super);
+
+ nada:
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cld);
+     return (plan *) 0;
+}
+
+static solver *mksolver(size_t q_ndx)
+{
+     static const solver_adt sadt = { PROBLEM_DFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->q_ndx = q_ndx;
+     return &(slv->super);
+}
+
+#endif /* HAVE_SIMD */
+
+void X(dft_vsplit_register)(planner *p)
+{
+#if HAVE_SIMD
+     size_t i;
+     for (i = 0; i < NELEM(qs); ++i)
+	  REGISTER_SOLVER(p, mksolver(i));
+#else
+     UNUSED(p);
+#endif
+}
@@ -165,6 +165,23 @@ type schedule =
   | Seq of (schedule * schedule)
   | Par of schedule list
 
+(* true if the computation in ALIST touches at most !Magic.registers
+   distinct variables, in which case it fits in the register file in
+   any order and partitioning it further buys nothing.  Every
+   assignment defines a variable, so ALIST must be short for this to
+   hold, which keeps the test cheap. *)
+let fits_in_registers alist =
+  let r = !Magic.registers in
+  r > 0 && List.length alist <= r &&
+  (let vars =
+     List.fold_left
+       (fun acc (Expr.Assign (v, x)) ->
+	 List.fold_left
+	   (fun acc y -> if List.memq y acc then acc else y :: acc)
+	   acc (v :: Expr.find_vars x))
+       [] alist
+   in List.length vars <= r)
+
 
 
 (* produce a sequential schedule determined by the user *)
@@ -181,8 +198,13 @@ let schedule =
 	| l -> Par (List.map schedule_alist l)
 
   and schedule_connected alist = 
-    match partition alist with
-    | (a, b) -> Seq (schedule_alist a, schedule_alist b)
+    if fits_in_registers alist then
+      (* leave the block in dataflow order, where the pipeline
+	 scheduler in annotate.ml is free to interleave it *)
+      sequentially alist
+    else
+      match partition alist with
+      | (a, b) -> Seq (schedule_alist a, schedule_alist b)
 
   in fun x ->
     let () = Util.info "begin schedule" in
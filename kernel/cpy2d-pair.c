@@ -21,9 +21,9 @@
 /* out of place copy routines for pairs of isomorphic 2D arrays */
 #include "kernel/ifftw.h"
 
-void X(cpy2d_pair)(R *I0, R *I1, R *O0, R *O1,
-		   INT n0, INT is0, INT os0,
-		   INT n1, INT is1, INT os1)
+static inline void cpy2d_pair(R *I0, R *I1, R *O0, R *O1,
+			      INT n0, INT is0, INT os0,
+			      INT n1, INT is1, INT os1)
 {
      INT i0, i1;
 
@@ -36,6 +36,36 @@ void X(cpy2d_pair)(R *I0, R *I1, R *O0, R *O1,
 	  }
 }
 
+void X(cpy2d_pair)(R *I0, R *I1, R *O0, R *O1,
+		   INT n0, INT is0, INT os0,
+		   INT n1, INT is1, INT os1)
+{
+     /* Conversions between split and interleaved unit-stride arrays.
+	With constant strides and offsets, the compiler turns the
+	inner loop into SIMD shuffles. */
+     if (is0 == 1 && os0 == 2) {
+	  if (O1 == O0 + 1) {
+	       cpy2d_pair(I0, I1, O0, O0 + 1, n0, 1, 2, n1, is1, os1);
+	       return;
+	  }
+	  if (O0 == O1 + 1) {
+	       cpy2d_pair(I1, I0, O1, O1 + 1, n0, 1, 2, n1, is1, os1);
+	       return;
+	  }
+     } else if (is0 == 2 && os0 == 1) {
+	  if (I1 == I0 + 1) {
+	       cpy2d_pair(I0, I0 + 1, O0, O1, n0, 2, 1, n1, is1, os1);
+	       return;
+	  }
+	  if (I0 == I1 + 1) {
+	       cpy2d_pair(I1, I1 + 1, O1, O0, n0, 2, 1, n1, is1, os1);
+	       return;
+	  }
+     }
+
+     cpy2d_pair(I0, I1, O0, O1, n0, is0, os0, n1, is1, os1);
+}
+
 void X(zero1d_pair)(R *O0, R *O1, INT n0, INT os0)
 {
      INT i0;
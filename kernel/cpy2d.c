@@ -25,6 +25,8 @@
 #  ifdef HAVE_XMMINTRIN_H
 #    include <xmmintrin.h>
 #    define WIDE_TYPE __m128
+     /* non-temporal store of a WIDE_TYPE, see X(cpy2d_nt) */
+#    define STREAM(p, x) _mm_stream_ps((float *)(p), x)
 #  endif
 #endif
 
@@ -33,6 +35,20 @@
 #  define WIDE_TYPE double
 #endif
 
+/* whether vl-tuples at I + i0 * is0 + i1 * is1 and O + ... can be
+   moved as WIDE_TYPEs, which is only worth it if WIDE_TYPE is wider
+   than a double */
+#define WIDEP(I, O, is0, os0, is1, os1, vl)				\
+     (1									\
+      && (sizeof(WIDE_TYPE) > sizeof(double))				\
+      && (((vl) * sizeof(R)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((size_t)(I)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((size_t)(O)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((is0) * sizeof(R)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((os0) * sizeof(R)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((is1) * sizeof(R)) % sizeof(WIDE_TYPE) == 0)			\
+      && (((os1) * sizeof(R)) % sizeof(WIDE_TYPE) == 0))
+
 void X(cpy2d)(R *I, R *O,
 	      INT n0, INT is0, INT os0,
 	      INT n1, INT is1, INT os1,
@@ -94,6 +110,20 @@ void X(cpy2d)(R *I, R *O,
 	      }
 	      break;
 	 default:
+	      if (WIDEP(I, O, is0, os0, is1, os1, vl)) {
+		   /* as in the vl == 2 case, for tuples of any length
+		      that is a multiple of the WIDE_TYPE */
+		   INT nw = vl * sizeof(R) / sizeof(WIDE_TYPE);
+		   for (i1 = 0; i1 < n1; ++i1)
+			for (i0 = 0; i0 < n0; ++i0) {
+			     const WIDE_TYPE *x =
+				  (const WIDE_TYPE *)&I[i0 * is0 + i1 * is1];
+			     WIDE_TYPE *y = (WIDE_TYPE *)&O[i0 * os0 + i1 * os1];
+			     for (v = 0; v < nw; ++v)
+				  y[v] = x[v];
+			}
+		   break;
+	      }
 	      for (i1 = 0; i1 < n1; ++i1)
 		   for (i0 = 0; i0 < n0; ++i0)
 			for (v = 0; v < vl; ++v) {
@@ -129,6 +159,61 @@ void X(cpy2d_co)(R *I, R *O,
 }
 
 
+/* whether X(cpy2d_nt) can use non-temporal stores for vl-tuples with
+   these strides */
+int X(cpy2d_nt_ok)(const R *I, const R *O,
+		   INT is0, INT os0, INT is1, INT os1, INT vl)
+{
+#ifdef STREAM
+     return WIDEP(I, O, is0, os0, is1, os1, vl);
+#else
+     UNUSED(I); UNUSED(O); UNUSED(is0); UNUSED(os0); UNUSED(is1);
+     UNUSED(os1); UNUSED(vl);
+     return 0;
+#endif
+}
+
+/* like cpy2d_co, but with non-temporal stores, which write the output
+   around the cache.  This only pays off when the output would evict
+   data that is still needed, i.e. for copies larger than the cache,
+   so the choice is left to the planner.  Alignment is checked
+   again here, because new-array execution need not preserve it
+   in builds without SIMD. */
+void X(cpy2d_nt)(R *I, R *O,
+		 INT n0, INT is0, INT os0,
+		 INT n1, INT is1, INT os1,
+		 INT vl)
+{
+#ifdef STREAM
+     INT i0, i1, v, nw = vl * sizeof(R) / sizeof(WIDE_TYPE);
+
+     if (!X(cpy2d_nt_ok)(I, O, is0, os0, is1, os1, vl)) {
+	  X(cpy2d_co)(I, O, n0, is0, os0, n1, is1, os1, vl);
+	  return;
+     }
+
+     if (IABS(os0) > IABS(os1)) {	/* inner loop is for n0 */
+	  INT t;
+	  t = n0; n0 = n1; n1 = t;
+	  t = is0; is0 = is1; is1 = t;
+	  t = os0; os0 = os1; os1 = t;
+     }
+
+     for (i1 = 0; i1 < n1; ++i1)
+	  for (i0 = 0; i0 < n0; ++i0) {
+	       const WIDE_TYPE *x = (const WIDE_TYPE *)&I[i0 * is0 + i1 * is1];
+	       WIDE_TYPE *y = (WIDE_TYPE *)&O[i0 * os0 + i1 * os1];
+	       for (v = 0; v < nw; ++v)
+		    STREAM(y + v, x[v]);
+	  }
+
+     /* order the streamed stores before anything that follows */
+     _mm_sfence();
+#else
+     X(cpy2d_co)(I, O, n0, is0, os0, n1, is1, os1, vl);
+#endif
+}
+
 /* tiled copy routines */
 struct cpy2d_closure {
      R *I, *O;
@@ -115,7 +115,8 @@ extern void X(extract_reim)(int sign, R *c, R **r, R **i);
     defined(HAVE_SVE)||                         \
     defined(HAVE_VSX)||                         \
     defined(HAVE_GENERIC_SIMD128) ||            \
-    defined(HAVE_GENERIC_SIMD256)
+    defined(HAVE_GENERIC_SIMD256) ||            \
+    defined(HAVE_GENERIC_SIMD512)
 #define HAVE_SIMD 1
 #else
 #define HAVE_SIMD 0
@@ -127,6 +128,7 @@ extern int X(have_simd_avx_128_fma)(void);
 extern int X(have_simd_avx2)(void);
 extern int X(have_simd_avx2_128)(void);
 extern int X(have_simd_avx512)(void);
+extern int X(have_simd_avx512_bf16)(void);
 extern int X(have_simd_altivec)(void);
 extern int X(have_simd_vsx)(void);
 extern int X(have_simd_neon)(void);
@@ -145,7 +147,7 @@ typedef struct scanner_s scanner;
 /*-----------------------------------------------------------------------*/
 /* alloca: */
 #if HAVE_SIMD
-#  if defined(HAVE_KCVI) || defined(HAVE_AVX512)
+#  if defined(HAVE_KCVI) || defined(HAVE_AVX512) || defined(HAVE_GENERIC_SIMD512)
 #    define MIN_ALIGNMENT 64
 #  elif defined(HAVE_AVX) || defined(HAVE_AVX2) || defined(HAVE_GENERIC_SIMD256)
 #    define MIN_ALIGNMENT 32  /* best alignment for AVX, conservative for
@@ -498,6 +500,13 @@ enum {
      PROBLEM_DFT,
      PROBLEM_RDFT,
      PROBLEM_RDFT2,
+     PROBLEM_DFT_OOC,
+     PROBLEM_NUFFT,
+     PROBLEM_CZT,
+     PROBLEM_STFT,
+     PROBLEM_FIR,
+     PROBLEM_MDCT,
+     PROBLEM_HALF,
 
      /* for mpi/ subdirectory */
      PROBLEM_MPI_DFT,
@@ -612,6 +621,7 @@ typedef struct slvdesc_s {
      unsigned nam_hash;
      int reg_id;
      int next_for_same_problem_kind;
+     int seq; /* configuration step that registered the solver */
 } slvdesc;
 
 typedef struct solution_s solution; /* opaque */
@@ -739,6 +749,9 @@ typedef struct {
 
 typedef enum { COST_SUM, COST_MAX } cost_kind;
 
+#define PROBLEM_KIND_BIT(kind) (1U << (kind))
+#define MAXDEFERRED 16
+
 struct planner_s {
      const planner_adt *adt;
      void (*hook)(struct planner_s *plnr, plan *pln,
@@ -755,6 +768,16 @@ struct planner_s {
      int cur_reg_id;
      int slvdescs_for_problem_kind[PROBLEM_LAST];
 
+     /* configuration routines not run yet, see X(planner_defer) */
+     struct {
+	  void (*conf)(planner *);
+	  unsigned kinds;
+	  int seq;
+     } deferred[MAXDEFERRED];
+     int ndeferred;
+     unsigned deferred_kinds; /* union of the KINDS still pending */
+     int cur_seq, nseq;
+
      wisdom_state_t wisdom_state;
 
      hashtab htab_blessed;
@@ -776,6 +799,7 @@ struct planner_s {
 
 planner *X(mkplanner)(void);
 void X(planner_destroy)(planner *ego);
+void X(planner_defer)(planner *ego, void (*conf)(planner *), unsigned kinds);
 
 /*
   Iterate over all solvers.   Read:
@@ -806,7 +830,7 @@ void X(planner_destroy)(planner *ego);
 	  slvdesc *p = ego->slvdescs + _cnt;			\
 	  solver *s = p->slv;					\
 	  what;							\
-	  _cnt = p->next_for_same_problem_kind;			\
+	  _cnt = ego->slvdescs[_cnt].next_for_same_problem_kind;	\
      }								\
 }
 
@@ -917,6 +941,7 @@ struct triggen_s {
 
 triggen *X(mktriggen)(enum wakefulness wakefulness, INT n);
 void X(triggen_destroy)(triggen *p);
+void X(cexpl_cycles)(trigreal t, trigreal *res);
 
 /*-----------------------------------------------------------------------*/
 /* primes.c: */
@@ -977,6 +1002,12 @@ void X(cpy2d_co)(R *I, R *O,
 		 INT n0, INT is0, INT os0,
 		 INT n1, INT is1, INT os1,
 		 INT vl);
+void X(cpy2d_nt)(R *I, R *O,
+		 INT n0, INT is0, INT os0,
+		 INT n1, INT is1, INT os1,
+		 INT vl);
+int X(cpy2d_nt_ok)(const R *I, const R *O,
+		   INT is0, INT os0, INT is1, INT os1, INT vl);
 void X(cpy2d_tiled)(R *I, R *O,
 		    INT n0, INT is0, INT os0,
 		    INT n1, INT is1, INT os1,
@@ -1005,6 +1036,27 @@ typedef void (*cpy2d_func)(R *I, R *O,
 			   INT n1, INT is1, INT os1,
 			   INT vl);
 
+/*-----------------------------------------------------------------------*/
+/* storage.c: formats of the arrays of half-precision problems.  The
+   values match the public X(storage) enum. */
+enum storage_fmt { FMT_R = 0, FMT_FP16 = 1, FMT_BF16 = 2 };
+
+size_t X(storage_size)(enum storage_fmt fmt);
+void X(storage_load)(R *O, INT os, const void *I, INT is, INT n,
+		     enum storage_fmt fmt);
+void X(storage_store)(void *O, INT os, const R *I, INT is, INT n,
+		      enum storage_fmt fmt);
+
+/* conversions of N contiguous numbers.  The half-precision solver
+   chooses them per plan, among the scalar ones of storage.c and the
+   SIMD ones in rdft/simd/<isa>/storage.c. */
+typedef struct {
+     void (*load)(R *O, const void *I, INT n);
+     void (*store)(void *O, const R *I, INT n);
+} storage_cvt;
+
+const storage_cvt *X(storage_cvt_scalar)(enum storage_fmt fmt);
+
 /*-----------------------------------------------------------------------*/
 /* misc stuff */
 void X(null_awake)(plan *ego, enum wakefulness wakefulness);
@@ -91,6 +91,18 @@ static void sgrow(planner *ego)
      X(ifree0)(otab);
 }
 
+#ifdef FFTW_DEBUG
+/* whether the deferred configuration routine being run declared KIND */
+static int kind_declared(const planner *ego, int kind)
+{
+     int i;
+     for (i = 0; i < ego->ndeferred; ++i)
+	  if (ego->deferred[i].seq == ego->cur_seq)
+	       return (ego->deferred[i].kinds & PROBLEM_KIND_BIT(kind)) != 0;
+     return 0;
+}
+#endif
+
 static void register_solver(planner *ego, solver *s)
 {
      slvdesc *n;
@@ -108,11 +120,13 @@ static void register_solver(planner *ego, solver *s)
 	  n->slv = s;
 	  n->reg_nam = ego->cur_reg_nam;
 	  n->reg_id = ego->cur_reg_id++;
+	  n->seq = ego->cur_seq;
 	  
 	  A(strlen(n->reg_nam) < MAXNAM);
 	  n->nam_hash = X(hash)(n->reg_nam);
 
 	  kind = s->adt->problem_kind;
+	  A(ego->cur_seq == ego->nseq - 1 || kind_declared(ego, kind));
 	  n->next_for_same_problem_kind = ego->slvdescs_for_problem_kind[kind];
 	  ego->slvdescs_for_problem_kind[kind] = (int)/*from unsigned*/ego->nslvdesc;
 
@@ -132,18 +146,70 @@ static unsigned slookup(planner *ego, char *nam, int id)
      return INFEASIBLE_SLVNDX;
 }
 
+/*
+  deferred configuration:
+
+  Registering every solver table up front costs more than planning a
+  small transform.  A configuration routine passed to X(planner_defer)
+  runs only when the planner first sees a problem of one of the KINDS
+  it registers solvers for, or when wisdom is read or written.
+*/
+void X(planner_defer)(planner *ego, void (*conf)(planner *), unsigned kinds)
+{
+     A(ego->ndeferred < MAXDEFERRED);
+     ego->deferred[ego->ndeferred].conf = conf;
+     ego->deferred[ego->ndeferred].kinds = kinds;
+     ego->deferred[ego->ndeferred].seq = ego->nseq++;
+     ego->deferred_kinds |= kinds;
+     ++ego->ndeferred;
+
+     /* solvers registered directly from now on come after CONF */
+     ego->cur_seq = ego->nseq++;
+}
+
+static void configure(planner *ego, unsigned kinds)
+{
+     int i, seq = ego->cur_seq;
+
+     for (i = 0; i < ego->ndeferred; ++i) {
+	  void (*conf)(planner *) = ego->deferred[i].conf;
+	  if (conf && (ego->deferred[i].kinds & kinds)) {
+	       /* clear first, so that each routine runs only once */
+	       ego->deferred[i].conf = 0;
+	       ego->cur_seq = ego->deferred[i].seq;
+	       conf(ego);
+	  }
+     }
+     ego->cur_seq = seq;
+
+     ego->deferred_kinds = 0;
+     for (i = 0; i < ego->ndeferred; ++i)
+	  if (ego->deferred[i].conf)
+	       ego->deferred_kinds |= ego->deferred[i].kinds;
+}
+
 /* Compute a MD5 hash of the configuration of the planner.
    We store it into the wisdom file to make absolutely sure that
-   we are reading wisdom that is applicable */
+   we are reading wisdom that is applicable.  Solvers are visited
+   in the order in which they would have been registered had no
+   configuration been deferred, so that the signature does not
+   depend on the order in which problem kinds were first planned. */
 static void signature_of_configuration(md5 *m, planner *ego)
 {
+     int seq;
+
+     configure(ego, ~0U);
      X(md5begin)(m);
      X(md5unsigned)(m, sizeof(R)); /* so we don't mix different precisions */
-     FORALL_SOLVERS(ego, s, sp, {
-	  UNUSED(s);
-	  X(md5int)(m, sp->reg_id);
-	  X(md5puts)(m, sp->reg_nam);
-     });
+     for (seq = 0; seq < ego->nseq; ++seq) {
+	  FORALL_SOLVERS(ego, s, sp, {
+	       UNUSED(s);
+	       if (sp->seq == seq) {
+		    X(md5int)(m, sp->reg_id);
+		    X(md5puts)(m, sp->reg_nam);
+	       }
+	  });
+     }
      X(md5end)(m);
 }
 
@@ -528,6 +594,9 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 
      FORALL_SOLVERS_OF_KIND(p->adt->problem_kind, ego, s, sp, {
 	  plan *pln;
+	  /* SP is stale once the solver has planned children of a
+	     kind whose configuration was deferred */
+	  unsigned ndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
 
 	  pln = invoke_solver(ego, p, s, flagsp);
 
@@ -552,13 +621,13 @@ static plan *search0(planner *ego, const problem *p, unsigned *slvndx,
 		    if (pln->pcost < best->pcost) {
 			 X(plan_destroy_internal)(best);
 			 best = pln;
-                         *slvndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);
+			 *slvndx = ndx;
 		    } else {
 			 X(plan_destroy_internal)(pln);
 		    }
 	       } else {
 		    best = pln;
-                    *slvndx = (unsigned)/*from ptrdiff_t*/(sp - ego->slvdescs);                    
+		    *slvndx = ndx;
 	       }
 
 	       if (ALLOW_PRUNINGP(ego) && could_prune_now_p) 
@@ -647,6 +716,9 @@ static plan *mkplan(planner *ego, const problem *p)
 
      ego->timed_out = 0;
 
+     if (ego->deferred_kinds & PROBLEM_KIND_BIT(p->adt->problem_kind))
+	  configure(ego, PROBLEM_KIND_BIT(p->adt->problem_kind));
+
      ++ego->nprob;
      md5hash(&m, p, ego);
 
@@ -931,6 +1003,10 @@ planner *X(mkplanner)(void)
 
      p->slvdescs = 0;
      p->nslvdesc = p->slvdescsiz = 0;
+     p->ndeferred = 0;
+     p->deferred_kinds = 0;
+     p->cur_seq = 0;
+     p->nseq = 1;
 
      p->flags.l = 0;
      p->flags.u = 0;
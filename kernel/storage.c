@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* conversion between R and the storage formats of the arrays of
+   half-precision problems (see rdft/problem-half.c).  FP16 is IEEE
+   binary16; BF16 is the upper half of an IEEE binary32.  Conversions
+   to 16 bits round to nearest even and keep infinities and NaNs.
+   Values are converted through float, which is exact when R is float
+   and may round twice otherwise.  SIMD versions of the contiguous
+   conversions are in rdft/simd/avx2 and rdft/simd/avx512. */
+
+#include "kernel/ifftw.h"
+
+typedef unsigned short h16;
+
+typedef union {
+     float f;
+     unsigned int u;
+} fbits;
+
+static inline float of_fp16(h16 h)
+{
+     /* Move exponent and mantissa into place and rebias.  Subnormals
+	are renormalized by a float subtraction, and infinities and
+	NaNs get the largest float exponent. */
+     const unsigned int expmask = 0x7c00U << 13;
+     fbits o, magic;
+     unsigned int e;
+
+     magic.u = 113U << 23;
+     o.u = ((unsigned int)h & 0x7fffU) << 13;
+     e = o.u & expmask;
+     o.u += (127U - 15U) << 23;
+     if (e == expmask)
+	  o.u += (128U - 16U) << 23;
+     else if (e == 0) {
+	  o.u += 1U << 23;
+	  o.f -= magic.f;
+     }
+     o.u |= ((unsigned int)h & 0x8000U) << 16;
+     return o.f;
+}
+
+static inline h16 to_fp16(float x)
+{
+     fbits f, denorm_magic;
+     unsigned int sign, o;
+
+     f.f = x;
+     sign = f.u & 0x80000000U;
+     f.u ^= sign;
+
+     if (f.u >= (127U + 16U) << 23)
+	  /* overflow to infinity, or NaN */
+	  o = (f.u > 255U << 23) ? 0x7e00U : 0x7c00U;
+     else if (f.u < 113U << 23) {
+	  /* subnormal or zero: let the float adder do the rounding */
+	  denorm_magic.u = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+	  f.f += denorm_magic.f;
+	  o = f.u - denorm_magic.u;
+     } else {
+	  unsigned int mant_odd = (f.u >> 13) & 1U;
+	  f.u += ((15U - 127U) << 23) + 0xfffU + mant_odd;
+	  o = f.u >> 13;
+     }
+     return (h16)(o | (sign >> 16));
+}
+
+static inline float of_bf16(h16 h)
+{
+     fbits f;
+     f.u = (unsigned int)h << 16;
+     return f.f;
+}
+
+static inline h16 to_bf16(float x)
+{
+     fbits f;
+     unsigned int r;
+
+     f.f = x;
+     r = (f.u + 0x7fffU + ((f.u >> 16) & 1U)) >> 16;
+
+     /* quiet NaNs rather than rounding them to infinity */
+     return (h16)(((f.u & 0x7fffffffU) > 0x7f800000U)
+		  ? ((f.u >> 16) | 0x40U) : r);
+}
+
+size_t X(storage_size)(enum storage_fmt fmt)
+{
+     return fmt == FMT_R ? sizeof(R) : sizeof(h16);
+}
+
+/* O[i * os] = I[i * is], i < n */
+void X(storage_load)(R *O, INT os, const void *I_, INT is, INT n,
+		     enum storage_fmt fmt)
+{
+     INT i;
+
+     switch (fmt) {
+	 case FMT_R: {
+	      const R *I = (const R *) I_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = I[i * is];
+	      break;
+	 }
+	 case FMT_FP16: {
+	      const h16 *I = (const h16 *) I_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = of_fp16(I[i * is]);
+	      break;
+	 }
+	 case FMT_BF16: {
+	      const h16 *I = (const h16 *) I_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = of_bf16(I[i * is]);
+	      break;
+	 }
+     }
+}
+
+/* O[i * os] = I[i * is], i < n */
+void X(storage_store)(void *O_, INT os, const R *I, INT is, INT n,
+		      enum storage_fmt fmt)
+{
+     INT i;
+
+     switch (fmt) {
+	 case FMT_R: {
+	      R *O = (R *) O_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = I[i * is];
+	      break;
+	 }
+	 case FMT_FP16: {
+	      h16 *O = (h16 *) O_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = to_fp16((float) I[i * is]);
+	      break;
+	 }
+	 case FMT_BF16: {
+	      h16 *O = (h16 *) O_;
+	      for (i = 0; i < n; ++i)
+		   O[i * os] = to_bf16((float) I[i * is]);
+	      break;
+	 }
+     }
+}
+
+/* contiguous conversions, for CPUs without SIMD ones */
+static void load_r(R *O, const void *I, INT n)
+{
+     X(storage_load)(O, 1, I, 1, n, FMT_R);
+}
+
+static void store_r(void *O, const R *I, INT n)
+{
+     X(storage_store)(O, 1, I, 1, n, FMT_R);
+}
+
+static void load_fp16(R *O, const void *I, INT n)
+{
+     X(storage_load)(O, 1, I, 1, n, FMT_FP16);
+}
+
+static void store_fp16(void *O, const R *I, INT n)
+{
+     X(storage_store)(O, 1, I, 1, n, FMT_FP16);
+}
+
+static void load_bf16(R *O, const void *I, INT n)
+{
+     X(storage_load)(O, 1, I, 1, n, FMT_BF16);
+}
+
+static void store_bf16(void *O, const R *I, INT n)
+{
+     X(storage_store)(O, 1, I, 1, n, FMT_BF16);
+}
+
+const storage_cvt *X(storage_cvt_scalar)(enum storage_fmt fmt)
+{
+     static const storage_cvt tab[] = {
+	  { load_r, store_r },
+	  { load_fp16, store_fp16 },
+	  { load_bf16, store_bf16 }
+     };
+     return &tab[fmt];
+}
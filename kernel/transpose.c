@@ -20,6 +20,28 @@
 
 #include "kernel/ifftw.h"
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#  ifdef HAVE_XMMINTRIN_H
+#    include <xmmintrin.h>
+#    define WIDE_TYPE __m128
+#  endif
+#endif
+
+#ifndef WIDE_TYPE
+/* fall back to double, which means that WIDE_TYPE will be unused */
+#  define WIDE_TYPE double
+#endif
+
+/* swap R[2] as WIDE_TYPE if WIDE_TYPE is large enough to hold R[2],
+   and if the array is properly aligned, as in X(cpy2d) */
+#define WIDE2P(I, s0, s1)					\
+     (1								\
+      && (2 * sizeof(R) == sizeof(WIDE_TYPE))			\
+      && (sizeof(WIDE_TYPE) > sizeof(double))			\
+      && (((size_t)(I)) % sizeof(WIDE_TYPE) == 0)		\
+      && (((s0) & 1) == 0)					\
+      && (((s1) & 1) == 0))
+
 /* in place square transposition, iterative */
 void X(transpose)(R *I, INT n, INT s0, INT s1, INT vl)
 {
@@ -37,6 +59,19 @@ void X(transpose)(R *I, INT n, INT s0, INT s1, INT vl)
 	      }
 	      break;
 	 case 2:
+	      if (WIDE2P(I, s0, s1)) {
+		   for (i1 = 1; i1 < n; ++i1) {
+			for (i0 = 0; i0 < i1; ++i0) {
+			     WIDE_TYPE *x = (WIDE_TYPE *)&I[i1 * s0 + i0 * s1];
+			     WIDE_TYPE *y = (WIDE_TYPE *)&I[i1 * s1 + i0 * s0];
+			     WIDE_TYPE x0 = *x;
+			     WIDE_TYPE y0 = *y;
+			     *y = x0;
+			     *x = y0;
+			}
+		   }
+		   break;
+	      }
 	      for (i1 = 1; i1 < n; ++i1) {
 		   for (i0 = 0; i0 < i1; ++i0) {
 			R x0 = I[i1 * s0 + i0 * s1];
@@ -90,6 +125,19 @@ static void dotile(INT n0l, INT n0u, INT n1l, INT n1u, void *args)
 	      }
 	      break;
 	 case 2:
+	      if (WIDE2P(I, s0, s1)) {
+		   for (i1 = n1l; i1 < n1u; ++i1) {
+			for (i0 = n0l; i0 < n0u; ++i0) {
+			     WIDE_TYPE *x = (WIDE_TYPE *)&I[i1 * s0 + i0 * s1];
+			     WIDE_TYPE *y = (WIDE_TYPE *)&I[i1 * s1 + i0 * s0];
+			     WIDE_TYPE x0 = *x;
+			     WIDE_TYPE y0 = *y;
+			     *y = x0;
+			     *x = y0;
+			}
+		   }
+		   break;
+	      }
 	      for (i1 = n1l; i1 < n1u; ++i1) {
 		   for (i0 = n0l; i0 < n0u; ++i0) {
 			R x0 = I[i1 * s0 + i0 * s1];
@@ -79,6 +79,22 @@ static void real_cexp(INT m, INT n, trigreal *out)
      out[1] = s; 
 }
 
+/* exp(2 pi i T) for a real T that need not be of the form M/N,
+   e.g. the chirp phases of the chirp-z transform */
+void X(cexpl_cycles)(trigreal t, trigreal *res)
+{
+     trigreal theta;
+
+     /* reduce to (-1/2, 1/2] before multiplication by 2 * PI */
+     t -= (trigreal)(INT)t;
+     if (t > KTRIG(0.5)) t -= KTRIG(1.0);
+     else if (t <= KTRIG(-0.5)) t += KTRIG(1.0);
+
+     theta = K2PI * t;
+     res[0] = COS(theta);
+     res[1] = SIN(theta);
+}
+
 static INT choose_twshft(INT n)
 {
      INT log2r = 0;
@@ -132,19 +132,23 @@ static R *compute(enum wakefulness wakefulness,
      p = instr;
      ntwiddle = twlen0(r, p, &vl);
 
-     A(m % vl == 0);
-
-     W0 = W = (R *)MALLOC((ntwiddle * (m / vl)) * sizeof(R), TWIDDLES);
+     /* if M is not a multiple of VL, the last block is padded for
+	the masked tail of a SIMD codelet; the padding lanes, whose
+	index exceeds M, are never stored and get the twiddle of
+	index 0 */
+     W0 = W = (R *)MALLOC((ntwiddle * ((m + vl - 1) / vl)) * sizeof(R),
+			  TWIDDLES);
 
      for (j = 0; j < m; j += vl) {
           for (p = instr; p->op != TW_NEXT; ++p) {
+	       INT k = (j + (INT)p->v <= m) ? j + (INT)p->v : 0;
 	       switch (p->op) {
 		   case TW_FULL: {
 			INT i;
 			for (i = 1; i < r; ++i) {
-			     A((j + (INT)p->v) * i < n);
-			     A((j + (INT)p->v) * i > -n);
-			     t->cexp(t, (j + (INT)p->v) * i, W);
+			     A(k * i < n);
+			     A(k * i > -n);
+			     t->cexp(t, k * i, W);
 			     W += 2;
 			}
 			break;
@@ -154,7 +158,7 @@ static R *compute(enum wakefulness wakefulness,
 			INT i;
 			A((r % 2) == 1);
 			for (i = 1; i + i < r; ++i) {
-			     t->cexp(t, MULMOD(i, (j + (INT)p->v), n), W);
+			     t->cexp(t, MULMOD(i, k, n), W);
 			     W += 2;
 			}
 			break;
@@ -163,9 +167,9 @@ static R *compute(enum wakefulness wakefulness,
 		   case TW_COS: {
 			R d[2];
 
-			A((j + (INT)p->v) * p->i < n);
-			A((j + (INT)p->v) * p->i > -n);
-			t->cexp(t, (j + (INT)p->v) * (INT)p->i, d);
+			A(k * p->i < n);
+			A(k * p->i > -n);
+			t->cexp(t, k * (INT)p->i, d);
 			*W++ = d[0];
 			break;
 		   }
@@ -173,17 +177,17 @@ static R *compute(enum wakefulness wakefulness,
 		   case TW_SIN: {
 			R d[2];
 
-			A((j + (INT)p->v) * p->i < n);
-			A((j + (INT)p->v) * p->i > -n);
-			t->cexp(t, (j + (INT)p->v) * (INT)p->i, d);
+			A(k * p->i < n);
+			A(k * p->i > -n);
+			t->cexp(t, k * (INT)p->i, d);
 			*W++ = d[1];
 			break;
 		   }
 
 		   case TW_CEXP:
-			A((j + (INT)p->v) * p->i < n);
-			A((j + (INT)p->v) * p->i > -n);
-			t->cexp(t, (j + (INT)p->v) * (INT)p->i, W);
+			A(k * p->i < n);
+			A(k * p->i > -n);
+			t->cexp(t, k * (INT)p->i, W);
 			W += 2;
 			break;
 	       }
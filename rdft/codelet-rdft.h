@@ -154,6 +154,7 @@ extern const solvtab X(solvtab_rdft_lsx);
 extern const solvtab X(solvtab_rdft_lasx);
 extern const solvtab X(solvtab_rdft_generic_simd128);
 extern const solvtab X(solvtab_rdft_generic_simd256);
+extern const solvtab X(solvtab_rdft_generic_simd512);
 
 /* real-input & output DFT-like codelets (DHT, etc.) */
 typedef struct kr2r_desc_s kr2r_desc;
@@ -33,8 +33,6 @@ static const solvtab s =
      SOLVTAB(X(rdft_generic_register)),
      SOLVTAB(X(rdft_rank_geq2_register)),
 
-     SOLVTAB(X(dft_r2hc_register)),
-
      SOLVTAB(X(rdft_dht_register)),
      SOLVTAB(X(dht_r2hc_register)),
      SOLVTAB(X(dht_rader_register)),
@@ -45,12 +43,29 @@ static const solvtab s =
      SOLVTAB(X(rdft2_buffered_register)),
      SOLVTAB(X(rdft2_rank_geq2_register)),
      SOLVTAB(X(rdft2_rdft_register)),
+     SOLVTAB(X(stft_register)),
+     SOLVTAB(X(fir_register)),
+     SOLVTAB(X(half_register)),
 
      SOLVTAB(X(hc2hc_generic_register)),
 
      SOLVTAB_END
 };
 
+/* solvers of DFT problems in terms of RDFT problems, registered
+   separately because their problem kind differs */
+static const solvtab sdft =
+{
+     SOLVTAB(X(dft_r2hc_register)),
+
+     SOLVTAB_END
+};
+
+void X(rdft_conf_dft)(planner *p)
+{
+     X(solvtab_exec)(sdft, p);
+}
+
 void X(rdft_conf_standard)(planner *p)
 {
      X(solvtab_exec)(s, p);
@@ -122,4 +137,7 @@ void X(rdft_conf_standard)(planner *p)
 #if HAVE_GENERIC_SIMD256
      X(solvtab_exec)(X(solvtab_rdft_generic_simd256), p);
 #endif
+#if HAVE_GENERIC_SIMD512
+     X(solvtab_exec)(X(solvtab_rdft_generic_simd512), p);
+#endif
 }
@@ -367,7 +367,7 @@ static plan *mkcldw(const hc2c_solver *ego_, rdft_kind kind,
      pln->extra_iter = extra_iter;
 
      X(ops_zero)(&pln->super.super.ops);
-     X(ops_madd2)(v * (((m - 1) / 2) / e->genus->vl),
+     X(ops_madd2)(v * (((m - 1) / 2 + e->genus->vl - 1) / e->genus->vl),
 		  &e->ops, &pln->super.super.ops);
      X(ops_madd2)(v, &cld0->ops, &pln->super.super.ops);
      X(ops_madd2)(v, &cldm->ops, &pln->super.super.ops);
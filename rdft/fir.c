@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Streaming FIR filter by uniformly partitioned overlap-save.
+
+   The taps are split into NP partitions of B taps, whose spectra
+   H[p] (of size 2B, scaled by 1/2B) are computed when the plan is
+   awakened.  For each block of B input samples, the last 2B samples
+   of the stream are transformed into the first slot of a frequency
+   domain delay line X, the output spectrum is accumulated as
+
+      Y = sum_{p < NP} X[p] H[p],
+
+   and the second half of the inverse transform of Y is the output.
+   Spectra are stored in split format, so that the multiply-accumulate
+   is a loop over contiguous arrays of real and imaginary parts that
+   the compiler can vectorize.  The same loop moves each spectrum to
+   the next slot of the delay line, so that the plan needs no index
+   into it.  The delay line and the last 2B samples are the state of
+   the plan, which the caller may own (see X(execute_fir)), so that
+   several streams can share the plan.
+
+   The user's block size is the latency; the planner may also split
+   it into NSUB partitions of size B = BLOCK / NSUB, which trades
+   transform size against the length of the delay line. */
+
+#include "rdft/rdft.h"
+
+/* the imaginary parts of a spectrum start a multiple of CALIGN reals
+   after the real parts, so that both are as aligned as the array */
+#ifdef MIN_ALIGNMENT
+#  define CALIGN ((INT) (MIN_ALIGNMENT / sizeof(R)))
+#else
+#  define CALIGN 4
+#endif
+
+typedef struct {
+     solver super;
+     INT nsub;
+} S;
+
+typedef struct {
+     plan_stream super;
+
+     plan *cldf;     /* r2c of 2B real samples into split spectrum */
+     plan *cldb;     /* c2r of split spectrum into 2B real samples */
+     INT ntaps, b, nsub, np;
+     INT nc;         /* B + 1 complex outputs */
+     INT cdist;      /* distance between real and imag parts */
+     R *h;           /* copy of the taps */
+
+     R *H;           /* NP partition spectra, 2 * CDIST each */
+} P;
+
+/* the state: the delay line of NP spectra, followed by the last 2B
+   samples of the stream */
+#define NSTATE(np, b, cdist) ((np) * 2 * (cdist) + 2 * (b))
+
+/* Y = X H, or Y += X H, over NC complex numbers in split format */
+static void mul(INT nc, const R *xr, const R *xi, 
+		const R *hr, const R *hi, R *yr, R *yi)
+{
+     INT k;
+     for (k = 0; k < nc; ++k) {
+	  E ar = xr[k], ai = xi[k], br = hr[k], bi = hi[k];
+	  yr[k] = ar * br - ai * bi;
+	  yi[k] = ar * bi + ai * br;
+     }
+}
+
+/* Y = X H, or Y += X H, and move X to (XRN, XIN) */
+static void mul_move(INT nc, const R *xr, const R *xi, 
+		     const R *hr, const R *hi, R *yr, R *yi,
+		     R *xrn, R *xin)
+{
+     INT k;
+     for (k = 0; k < nc; ++k) {
+	  E ar = xr[k], ai = xi[k], br = hr[k], bi = hi[k];
+	  xrn[k] = ar;
+	  xin[k] = ai;
+	  yr[k] = ar * br - ai * bi;
+	  yi[k] = ar * bi + ai * br;
+     }
+}
+
+static void mac_move(INT nc, const R *xr, const R *xi, 
+		     const R *hr, const R *hi, R *yr, R *yi,
+		     R *xrn, R *xin)
+{
+     INT k;
+     for (k = 0; k < nc; ++k) {
+	  E ar = xr[k], ai = xi[k], br = hr[k], bi = hi[k];
+	  xrn[k] = ar;
+	  xin[k] = ai;
+	  yr[k] = yr[k] + (ar * br - ai * bi);
+	  yi[k] = yi[k] + (ar * bi + ai * br);
+     }
+}
+
+static void mac(INT nc, const R *xr, const R *xi, 
+		const R *hr, const R *hi, R *yr, R *yi)
+{
+     INT k;
+     for (k = 0; k < nc; ++k) {
+	  E ar = xr[k], ai = xi[k], br = hr[k], bi = hi[k];
+	  yr[k] = yr[k] + (ar * br - ai * bi);
+	  yi[k] = yi[k] + (ar * bi + ai * br);
+     }
+}
+
+static void apply(const plan *ego_, R *state, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft2 *cldf = (plan_rdft2 *) ego->cldf;
+     plan_rdft2 *cldb = (plan_rdft2 *) ego->cldb;
+     INT b = ego->b, np = ego->np, nc = ego->nc, cdist = ego->cdist;
+     INT s, i, p;
+     R *X = state, *x = state + np * 2 * cdist, *H = ego->H;
+     R *Y = (R *)MALLOC(sizeof(R) * (2 * cdist + 2 * b), BUFFERS);
+     R *y = Y + 2 * cdist;
+
+     for (s = 0; s < ego->nsub; ++s, I += b, O += b) {
+	  /* slide the stream by B samples.  I and O may be the
+	     same array: the input block is read before it is
+	     overwritten */
+	  for (i = 0; i < b; ++i) {
+	       x[i] = x[b + i];
+	       x[b + i] = I[i];
+	  }
+
+	  /* older partitions, moving each spectrum one slot down the
+	     delay line.  Going backwards, no slot is overwritten
+	     before it has been read. */
+	  for (p = np - 1; p > 0; --p) {
+	       R *Xp = X + (p - 1) * 2 * cdist, *Xn = Xp + 2 * cdist;
+	       R *Hp = H + p * 2 * cdist;
+	       if (p == np - 1)
+		    mul_move(nc, Xp, Xp + cdist, Hp, Hp + cdist,
+			     Y, Y + cdist, Xn, Xn + cdist);
+	       else
+		    mac_move(nc, Xp, Xp + cdist, Hp, Hp + cdist,
+			     Y, Y + cdist, Xn, Xn + cdist);
+	  }
+
+	  cldf->apply((plan *) cldf, x, x + 1, X, X + cdist);
+	  if (np == 1)
+	       mul(nc, X, X + cdist, H, H + cdist, Y, Y + cdist);
+	  else
+	       mac(nc, X, X + cdist, H, H + cdist, Y, Y + cdist);
+
+	  /* Y is destroyed */
+	  cldb->apply((plan *) cldb, y, y + 1, Y, Y + cdist);
+
+	  for (i = 0; i < b; ++i)
+	       O[i] = y[b + i];
+     }
+
+     X(ifree)(Y);
+}
+
+static void mkspectra(P *ego)
+{
+     plan_rdft2 *cldf = (plan_rdft2 *) ego->cldf;
+     INT b = ego->b, ntaps = ego->ntaps, i, p;
+     R *x = (R *) MALLOC(sizeof(R) * 2 * b, BUFFERS);
+     E scale = K(1.0) / (E)(2 * b);
+
+     for (p = 0; p < ego->np; ++p) {
+	  R *Hp = ego->H + p * 2 * ego->cdist;
+	  for (i = 0; i < 2 * b; ++i)
+	       x[i] = (i < b && p * b + i < ntaps) ? 
+		    ego->h[p * b + i] * scale : K(0.0);
+	  /* cldf must be awake */
+	  cldf->apply((plan *) cldf, x, x + 1, Hp, Hp + ego->cdist);
+     }
+
+     X(ifree)(x);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cldf, wakefulness);
+     X(plan_awake)(ego->cldb, wakefulness);
+
+     /* the stream starts with silence */
+     X(stream_awake)(&ego->super, wakefulness);
+
+     switch (wakefulness) {
+	 case SLEEPY:
+	      X(ifree0)(ego->H); ego->H = 0;
+	      break;
+	 default:
+	      A(!ego->H);
+	      ego->H = (R *) MALLOC(sizeof(R) * ego->np * 2 * ego->cdist,
+				    TWIDDLES);
+	      mkspectra(ego);
+	      break;
+     }
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(ifree0)(ego->h);
+     X(plan_destroy_internal)(ego->cldb);
+     X(plan_destroy_internal)(ego->cldf);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(fir-%D%v/%D%(%p%)%(%p%))",
+              ego->b, ego->nsub, ego->np, ego->cldf, ego->cldb);
+}
+
+static int applicable(const S *ego, const problem *p_)
+{
+     const problem_fir *p = (const problem_fir *) p_;
+     return (1
+	     && p->block % ego->nsub == 0
+	     /* splitting small blocks only adds overhead */
+	     && (ego->nsub == 1 || p->block / ego->nsub >= 32)
+	  );
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_fir *p = (const problem_fir *) p_;
+     P *pln;
+     plan *cldf = 0, *cldb = 0;
+     R *x = 0, *Xn = 0, *h;
+     INT i, b, np, nc, cdist;
+     opcnt ops;
+
+     static const plan_adt padt = {
+	  X(fir_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_))
+          return (plan *) 0;
+
+     b = p->block / ego->nsub;
+     np = (p->ntaps + b - 1) / b;
+     nc = b + 1;
+     cdist = ((nc + CALIGN - 1) / CALIGN) * CALIGN;
+
+     /* initial allocation for the purpose of planning */
+     x = (R *) MALLOC(sizeof(R) * 2 * b, BUFFERS);
+     Xn = (R *) MALLOC(sizeof(R) * 2 * cdist, BUFFERS);
+
+     /* the second half of the stream is needed by the next block */
+     cldf = X(mkplan_f_d)(plnr, 
+			  X(mkproblem_rdft2_d_3pointers)(
+			       X(mktensor_1d)(2 * b, 1, 1),
+			       X(mktensor_0d)(),
+			       x, Xn, Xn + cdist, R2HC),
+			  NO_DESTROY_INPUT, 0, 0);
+     if (!cldf) goto nada;
+
+     cldb = X(mkplan_d)(plnr, 
+			X(mkproblem_rdft2_d_3pointers)(
+			     X(mktensor_1d)(2 * b, 1, 1),
+			     X(mktensor_0d)(),
+			     x, Xn, Xn + cdist, HC2R));
+     if (!cldb) goto nada;
+
+     X(ifree)(Xn);
+     X(ifree)(x);
+
+     h = (R *) MALLOC(sizeof(R) * p->ntaps, TWIDDLES);
+     for (i = 0; i < p->ntaps; ++i) 
+	  h[i] = p->h[i];
+
+     pln = MKPLAN_STREAM(P, &padt, apply, NSTATE(np, b, cdist));
+     pln->cldf = cldf;
+     pln->cldb = cldb;
+     pln->ntaps = p->ntaps;
+     pln->b = b;
+     pln->nsub = ego->nsub;
+     pln->np = np;
+     pln->nc = nc;
+     pln->cdist = cdist;
+     pln->h = h;
+     pln->H = 0;
+
+     /* cost of one partition */
+     X(ops_add)(&cldf->ops, &cldb->ops, &ops);
+     ops.add += 4 * np * nc;
+     ops.mul += 4 * np * nc;
+     ops.other += 3 * b + 4 * np * nc;
+
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(ego->nsub, &ops, &pln->super.super.ops);
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(Xn);
+     X(ifree0)(x);
+     X(plan_destroy_internal)(cldb);
+     X(plan_destroy_internal)(cldf);
+     return (plan *) 0;
+}
+
+static solver *mksolver(INT nsub)
+{
+     static const solver_adt sadt = { PROBLEM_FIR, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->nsub = nsub;
+     return &(slv->super);
+}
+
+void X(fir_register)(planner *p)
+{
+     static const INT nsubs[] = { 1, 2, 4, 8 };
+     size_t i;
+     for (i = 0; i < NELEM(nsubs); ++i)
+	  REGISTER_SOLVER(p, mksolver(nsubs[i]));
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Transforms of arrays stored in 16-bit formats, computed in R.
+
+   The vector of transforms is processed in batches of NBUF.  Each
+   batch is converted into a buffer of R, transformed by an ordinary
+   DFT or RDFT2 child plan into a second buffer, and converted back to
+   the storage format of the output.  The conversions are the only
+   passes over the user arrays, which are thus read and written in 16
+   bits, while the batch stays in cache for the child. */
+
+#include "rdft/rdft.h"
+#include "dft/dft.h"
+
+typedef struct {
+     solver super;
+     size_t maxnbuf_ndx;
+} S;
+
+static const INT maxnbufs[] = { 8, 256 };
+
+/* in R, enough for the widest SIMD vectors */
+#define BOFF_ALIGN 16
+
+typedef struct {
+     plan_half super;
+
+     plan *cld, *cldrest;
+     INT vl, nbuf;
+     INT ni, mi, no, mo;	/* elements, and numbers per element */
+     INT bdi, bdo;		/* buffer distances */
+     INT boff;			/* offset of the output buffer */
+     INT is, idist, os, odist;
+     enum storage_fmt ifmt, ofmt;
+     const storage_cvt *icvt, *ocvt;	/* for contiguous elements */
+     int kind;
+     INT roffset, ioffset;	/* of the complex DFT in the buffers */
+} P;
+
+/* convert NB transforms of the input into BUF */
+static void load(const P *ego, const char *I, INT nb, R *buf)
+{
+     INT sz = (INT) X(storage_size)(ego->ifmt);
+     INT v, j, ni = ego->ni, mi = ego->mi, is = ego->is;
+
+     for (v = 0; v < nb; ++v, I += ego->idist * sz, buf += ego->bdi) {
+	  if (is == mi)
+	       ego->icvt->load(buf, I, ni * mi);
+	  else
+	       for (j = 0; j < mi; ++j)
+		    X(storage_load)(buf + j, mi, I + j * sz, is, ni, 
+				    ego->ifmt);
+     }
+}
+
+/* convert NB transforms from BUF into the output */
+static void store(const P *ego, const R *buf, INT nb, char *O)
+{
+     INT sz = (INT) X(storage_size)(ego->ofmt);
+     INT v, j, no = ego->no, mo = ego->mo, os = ego->os;
+
+     for (v = 0; v < nb; ++v, O += ego->odist * sz, buf += ego->bdo) {
+	  if (os == mo)
+	       ego->ocvt->store(O, buf, no * mo);
+	  else
+	       for (j = 0; j < mo; ++j)
+		    X(storage_store)(O + j * sz, os, buf + j, mo, no, 
+				     ego->ofmt);
+     }
+}
+
+/* transform the buffer BI into BO with CLD, which is a plan_dft or
+   a plan_rdft2 depending on the kind of transform */
+static void transform(const P *ego, plan *cld, R *bi, R *bo)
+{
+     switch (ego->kind) {
+	 case HALF_DFT: {
+	      plan_dft *cld_ = (plan_dft *) cld;
+	      INT r = ego->roffset, i = ego->ioffset;
+	      cld_->apply(cld, bi + r, bi + i, bo + r, bo + i);
+	      break;
+	 }
+	 case HALF_R2C: {
+	      plan_rdft2 *cld_ = (plan_rdft2 *) cld;
+	      cld_->apply(cld, bi, bi + 1, bo, bo + 1);
+	      break;
+	 }
+	 case HALF_C2R: {
+	      plan_rdft2 *cld_ = (plan_rdft2 *) cld;
+	      cld_->apply(cld, bo, bo + 1, bi, bi + 1);
+	      break;
+	 }
+     }
+}
+
+static void apply(const plan *ego_, void *I_, void *O_)
+{
+     const P *ego = (const P *) ego_;
+     INT v, nbuf = ego->nbuf, vl = ego->vl;
+     const char *I = (const char *) I_;
+     char *O = (char *) O_;
+     INT ivs_by_nbuf = nbuf * ego->idist * (INT) X(storage_size)(ego->ifmt);
+     INT ovs_by_nbuf = nbuf * ego->odist * (INT) X(storage_size)(ego->ofmt);
+     R *bi = (R *)MALLOC(sizeof(R) * (ego->boff + nbuf * ego->bdo),
+			 BUFFERS);
+     R *bo = bi + ego->boff;
+
+     for (v = nbuf; v <= vl; v += nbuf) {
+	  load(ego, I, nbuf, bi);
+	  transform(ego, ego->cld, bi, bo);
+	  store(ego, bo, nbuf, O);
+	  I += ivs_by_nbuf; O += ovs_by_nbuf;
+     }
+
+     /* Do the remaining transforms, if any: */
+     if (vl % nbuf) {
+	  load(ego, I, vl % nbuf, bi);
+	  transform(ego, ego->cldrest, bi, bo);
+	  store(ego, bo, vl % nbuf, O);
+     }
+
+     X(ifree)(bi);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     static const char *kinds[] = { "dft", "r2c", "c2r" };
+     static const char *fmts[] = { "r", "fp16", "bf16" };
+     const P *ego = (const P *) ego_;
+     p->print(p, "(half-%s-%s-%s%v/%D%(%p%)%(%p%))",
+	      kinds[ego->kind], fmts[ego->ifmt], fmts[ego->ofmt],
+	      ego->nbuf, ego->vl, ego->cld, ego->cldrest);
+}
+
+/* numbers of R per transform in the buffers, halved, which is the
+   size of the transform in the units of X(nbuf) */
+static INT bufsz(const problem_half *p)
+{
+     INT ni, mi, no, mo;
+     X(half_sizes)(p, &ni, &mi, &no, &mo);
+     return X(imax)(1, (ni * mi + no * mo) / 2);
+}
+
+static int applicable(const S *ego, const problem *p_)
+{
+     const problem_half *p = (const problem_half *) p_;
+
+     /* This is the only solver for half-precision problems, so it
+	ignores NO_BUFFERING and CONSERVE_MEMORY.  If this solver is
+	redundant, in the sense that a solver of lower index generates
+	the same plan, then prune this solver. */
+     return !X(nbuf_redundant)(bufsz(p), p->vl, ego->maxnbuf_ndx, 
+			       maxnbufs, NELEM(maxnbufs));
+}
+
+/* the DFT of sign +1 swaps real and imaginary parts */
+static INT roffset(const problem_half *p)
+{
+     return (p->sign == FFT_SIGN) ? 0 : 1;
+}
+
+/* the conversions of contiguous numbers in FMT, with the widest SIMD
+   that this CPU has */
+static const storage_cvt *choose_cvt(enum storage_fmt fmt,
+				     const planner *plnr)
+{
+     const storage_cvt *cvt = 0;
+
+     if (NO_SIMDP(plnr))
+	  return X(storage_cvt_scalar)(fmt);
+
+#if HAVE_AVX512
+     if (!cvt && X(have_simd_avx512)())
+	  cvt = X(storage_cvt_avx512)(fmt);
+#endif
+#if HAVE_AVX2
+     if (!cvt && X(have_simd_avx2)())
+	  cvt = X(storage_cvt_avx2)(fmt);
+#endif
+     return cvt ? cvt : X(storage_cvt_scalar)(fmt);
+}
+
+/* child transforming NB buffers BI into BO */
+static problem *mkcld(const problem_half *p, INT nb, 
+		      R *bi, INT bdi, R *bo, INT bdo)
+{
+     tensor *vecsz = X(mktensor_1d)(nb, bdi, bdo);
+     INT r = roffset(p), i = 1 - r;
+
+     switch (p->kind) {
+	 case HALF_DFT:
+	      return X(mkproblem_dft_d)(X(mktensor_1d)(p->n, 2, 2), vecsz,
+					bi + r, bi + i, bo + r, bo + i);
+	 case HALF_R2C:
+	      return X(mkproblem_rdft2_d_3pointers)(
+		   X(mktensor_1d)(p->n, 1, 2), vecsz, 
+		   bi, bo, bo + 1, R2HC);
+	 default:
+	      return X(mkproblem_rdft2_d_3pointers)(
+		   X(mktensor_1d)(p->n, 2, 1), vecsz,
+		   bo, bi, bi + 1, HC2R);
+     }
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_half *p = (const problem_half *) p_;
+     P *pln;
+     plan *cld = 0, *cldrest = 0;
+     R *bi = (R *) 0, *bo;
+     INT ni, mi, no, mo, nbuf, bdi, bdo, boff, vl = p->vl;
+
+     static const plan_adt padt = {
+	  X(half_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_))
+          return (plan *) 0;
+
+     X(half_sizes)(p, &ni, &mi, &no, &mo);
+     nbuf = X(nbuf)(bufsz(p), vl, maxnbufs[ego->maxnbuf_ndx]);
+
+     /* keep pairs of R together for SIMD */
+     bdi = 2 * X(bufdist)((ni * mi + 1) / 2, nbuf);
+     bdo = 2 * X(bufdist)((no * mo + 1) / 2, nbuf);
+
+     /* align the output buffer like the input buffer */
+     boff = nbuf * bdi + X(modulo)(-nbuf * bdi, BOFF_ALIGN);
+
+     /* initial allocation for the purpose of planning */
+     bi = (R *) MALLOC(sizeof(R) * (boff + nbuf * bdo), BUFFERS);
+     bo = bi + boff;
+
+     /* the buffers are ours, and can be destroyed */
+     cld = X(mkplan_d)(plnr, mkcld(p, nbuf, bi, bdi, bo, bdo));
+     if (!cld) goto nada;
+
+     cldrest = X(mkplan_d)(plnr, mkcld(p, vl % nbuf, bi, bdi, bo, bdo));
+     if (!cldrest) goto nada;
+
+     X(ifree)(bi); bi = 0;
+
+     pln = MKPLAN_HALF(P, &padt, apply);
+     pln->cld = cld;
+     pln->cldrest = cldrest;
+     pln->vl = vl;
+     pln->nbuf = nbuf;
+     pln->ni = ni;
+     pln->mi = mi;
+     pln->no = no;
+     pln->mo = mo;
+     pln->bdi = bdi;
+     pln->bdo = bdo;
+     pln->boff = boff;
+     pln->is = p->is;
+     pln->idist = p->idist;
+     pln->os = p->os;
+     pln->odist = p->odist;
+     pln->ifmt = p->ifmt;
+     pln->ofmt = p->ofmt;
+     pln->icvt = choose_cvt(p->ifmt, plnr);
+     pln->ocvt = choose_cvt(p->ofmt, plnr);
+     pln->kind = p->kind;
+     pln->roffset = roffset(p);
+     pln->ioffset = 1 - pln->roffset;
+
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(vl / nbuf, &cld->ops, &pln->super.super.ops);
+     X(ops_add2)(&cldrest->ops, &pln->super.super.ops);
+     pln->super.super.ops.other += vl * (ni * mi + no * mo);
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(bi);
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cld);
+     return (plan *) 0;
+}
+
+static solver *mksolver(size_t maxnbuf_ndx)
+{
+     static const solver_adt sadt = { PROBLEM_HALF, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->maxnbuf_ndx = maxnbuf_ndx;
+     return &(slv->super);
+}
+
+void X(half_register)(planner *p)
+{
+     size_t i;
+     for (i = 0; i < NELEM(maxnbufs); ++i)
+	  REGISTER_SOLVER(p, mksolver(i));
+}
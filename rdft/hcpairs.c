@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+/* Loops over the {i, n - i} pairs of a halfcomplex array, for the
+   pre- and post-processing passes of the reodft solvers and for the
+   halfcomplex <-> complex copies of rdft2.
+
+   Each loop is written once as an inline function of its strides, and
+   instantiated with constant strides for the common unit-stride (and
+   in-place) cases, which the compiler then vectorizes, reversed
+   accesses included.  Each pair is read before it is written, so the
+   passes may be done in place. */
+
+#include "rdft/rdft.h"
+
+/* For 1 <= i < n - i, with x = a[as * i] and y = b[bs * i], replaced
+   by x - y and x + y if SUMDIFF:
+
+      c[cs * i] = cscale * (W[2 i] x + W[2 i + 1] y)
+      d[ds * i] = dscale * (W[2 i] y - W[2 i + 1] x)
+
+   i.e. a rotation of the pair by the twiddle factor. */
+static inline void rotate(INT n, const R *a, INT as, const R *b, INT bs,
+			  R *c, INT cs, R *d, INT ds, const R *W,
+			  int sumdiff, R cscale, R dscale)
+{
+     INT i, m = (n + 1) / 2; /* i < m iff i < n - i */
+     for (i = 1; i < m; ++i) {
+	  E x = a[as * i], y = b[bs * i];
+	  E wa = W[2 * i], wb = W[2 * i + 1];
+	  if (sumdiff) {
+	       E s = x + y, t = x - y;
+	       x = t;
+	       y = s;
+	  }
+	  c[cs * i] = cscale * (wa * x + wb * y);
+	  d[ds * i] = dscale * (wa * y - wb * x);
+     }
+}
+
+/* instantiate ROTATE with constant SUMDIFF */
+#define ROTATE(a, as, b, bs, c, cs, d, ds)				\
+     if (sumdiff)							\
+	  rotate(n, a, as, b, bs, c, cs, d, ds, W, 1, cscale, dscale);	\
+     else								\
+	  rotate(n, a, as, b, bs, c, cs, d, ds, W, 0, cscale, dscale)
+
+void X(hc_rotate)(INT n, const R *a, INT as, const R *b, INT bs,
+		  R *c, INT cs, R *d, INT ds, const R *W,
+		  int sumdiff, R cscale, R dscale)
+{
+     if (as == 1 && bs == -1 && cs == 1 && ds == -1) {
+	  if (a == c && b == d) {
+	       /* in place: read through C and D so that the compiler
+		  sees that each pair only depends on itself */
+	       ROTATE(c, 1, d, -1, c, 1, d, -1);
+	  } else {
+	       ROTATE(a, 1, b, -1, c, 1, d, -1);
+	  }
+     } else if (cs == 1 && ds == -1) {
+	  ROTATE(a, as, b, bs, c, 1, d, -1);
+     } else if (as == 1 && bs == -1) {
+	  ROTATE(a, 1, b, -1, c, cs, d, ds);
+     } else {
+	  ROTATE(a, as, b, bs, c, cs, d, ds);
+     }
+}
+
+/* For 1 <= i < n - i, with a = buf[i] and b = buf[n - i]:
+
+      O[os * (2 i - 1)] = sgn * (a - b) * W[2 i - 1]
+      O[os * 2 i]       =       (a + b) * W[2 i]
+
+   where the W factors are omitted if W is null. */
+static inline void unfold(INT n, const R *buf, R *O, INT os, const R *W,
+			  R sgn)
+{
+     INT i, m = (n + 1) / 2; /* i < m iff i < n - i */
+     for (i = 1; i < m; ++i) {
+	  E a = buf[i], b = buf[n - i];
+	  E t = sgn * (a - b), s = a + b;
+	  if (W) {
+	       t = W[2 * i - 1] * t;
+	       s = W[2 * i] * s;
+	  }
+	  O[os * (2 * i - 1)] = t;
+	  O[os * (2 * i)] = s;
+     }
+}
+
+void X(hc_unfold)(INT n, const R *buf, R *O, INT os, const R *W, R sgn)
+{
+     if (os == 1) {
+	  if (W)
+	       unfold(n, buf, O, 1, W, sgn);
+	  else
+	       unfold(n, buf, O, 1, 0, sgn);
+     } else
+	  unfold(n, buf, O, os, W, sgn);
+}
+
+/* For 1 <= i < n - i: c[cs * i] = a[as * i], d[ds * i] = b[bs * i] */
+static inline void copy(INT n, const R *a, INT as, const R *b, INT bs,
+			R *c, INT cs, R *d, INT ds)
+{
+     INT i, m = (n + 1) / 2; /* i < m iff i < n - i */
+     for (i = 1; i < m; ++i) {
+	  R x = a[as * i], y = b[bs * i];
+	  c[cs * i] = x;
+	  d[ds * i] = y;
+     }
+}
+
+void X(hc_copy)(INT n, const R *a, INT as, const R *b, INT bs,
+		R *c, INT cs, R *d, INT ds)
+{
+     if (as == 1 && bs == -1) {
+	  if (d == c + 1 && cs == 2 && ds == 2)
+	       /* interleaved complex output */
+	       copy(n, a, 1, b, -1, c, 2, c + 1, 2);
+	  else
+	       copy(n, a, 1, b, -1, c, cs, d, ds);
+     } else if (cs == 1 && ds == -1) {
+	  if (b == a + 1 && as == 2 && bs == 2)
+	       /* interleaved complex input */
+	       copy(n, a, 2, a + 1, 2, c, 1, d, -1);
+	  else
+	       copy(n, a, as, b, bs, c, 1, d, -1);
+     } else
+	  copy(n, a, as, b, bs, c, cs, d, ds);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "rdft/rdft.h"
+
+plan *X(mkplan_stream)(size_t size, const plan_adt *adt, 
+		       streamapply apply, INT nstate)
+{
+     plan_stream *ego;
+
+     ego = (plan_stream *) X(mkplan)(size, adt);
+     ego->apply = apply;
+     ego->nstate = nstate;
+     ego->state = 0;
+
+     return &(ego->super);
+}
+
+/* allocate the state used by X(execute), initially zero, or free it */
+void X(stream_awake)(plan_stream *ego, enum wakefulness wakefulness)
+{
+     INT i;
+
+     switch (wakefulness) {
+	 case SLEEPY:
+	      X(ifree0)(ego->state); ego->state = 0;
+	      break;
+	 default:
+	      A(!ego->state);
+	      if (ego->nstate > 0) {
+		   ego->state = (R *) MALLOC(sizeof(R) * ego->nstate, PLANS);
+		   for (i = 0; i < ego->nstate; ++i) 
+			ego->state[i] = K(0.0);
+	      }
+	      break;
+     }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "rdft/rdft.h"
+
+static void destroy(problem *ego_)
+{
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_fir *p = (const problem_fir *) p_;
+     X(md5puts)(m, "fir");
+     X(md5int)(m, p->in == p->out);
+     X(md5INT)(m, p->ntaps);
+     X(md5INT)(m, p->block);
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_fir *ego = (const problem_fir *) ego_;
+     p->print(p, "(fir %d %D %D)", 
+	      ego->in == ego->out, ego->ntaps, ego->block);
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_fir *ego = (const problem_fir *) ego_;
+     R *in = UNTAINT(ego->in);
+     INT i;
+
+     for (i = 0; i < ego->block; ++i) 
+	  in[i] = K(0.0);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_FIR,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_fir)(INT ntaps, const R *h, INT block, R *in, R *out)
+{
+     problem_fir *ego;
+
+     A(ntaps > 0 && block > 0);
+
+     ego = (problem_fir *)X(mkproblem)(sizeof(problem_fir), &padt);
+
+     ego->ntaps = ntaps;
+     ego->h = h;
+     ego->block = block;
+     ego->in = in;
+     ego->out = out;
+
+     return &(ego->super);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "rdft/rdft.h"
+#include <string.h>		/* for memset() */
+
+static void destroy(problem *ego_)
+{
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_half *p = (const problem_half *) p_;
+     X(md5puts)(m, "half");
+     X(md5int)(m, p->kind);
+     X(md5int)(m, p->sign);
+     X(md5int)(m, p->I == p->O);
+     X(md5INT)(m, p->n);
+     X(md5INT)(m, p->vl);
+     X(md5INT)(m, p->is);
+     X(md5INT)(m, p->idist);
+     X(md5INT)(m, p->os);
+     X(md5INT)(m, p->odist);
+     X(md5int)(m, p->ifmt);
+     X(md5int)(m, p->ofmt);
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_half *ego = (const problem_half *) ego_;
+     p->print(p, "(half %d %d %d %D %D %D %D %D %D %d %d)", 
+	      ego->kind, ego->sign, ego->I == ego->O, ego->n, ego->vl,
+	      ego->is, ego->idist, ego->os, ego->odist, 
+	      (int)ego->ifmt, (int)ego->ofmt);
+}
+
+/* elements NI and NO of the input and output of each transform, and
+   numbers MI and MO of R per element */
+void X(half_sizes)(const problem_half *p, INT *ni, INT *mi, 
+		   INT *no, INT *mo)
+{
+     *ni = (p->kind == HALF_C2R) ? p->n / 2 + 1 : p->n;
+     *mi = (p->kind == HALF_R2C) ? 1 : 2;
+     *no = (p->kind == HALF_R2C) ? p->n / 2 + 1 : p->n;
+     *mo = (p->kind == HALF_C2R) ? 1 : 2;
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_half *ego = (const problem_half *) ego_;
+     INT sz = (INT) X(storage_size)(ego->ifmt);
+     INT i, v, ni, mi, no, mo;
+     char *I = (char *) ego->I;
+
+     X(half_sizes)(ego, &ni, &mi, &no, &mo);
+
+     /* all-zero bits are zero in every storage format */
+     for (v = 0; v < ego->vl; ++v)
+	  for (i = 0; i < ni; ++i)
+	       memset(I + (i * ego->is + v * ego->idist) * sz, 0, 
+		      (size_t)(mi * sz));
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_HALF,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_half)(int kind, INT n, INT vl,
+			   void *I, INT is, INT idist, enum storage_fmt ifmt,
+			   void *O, INT os, INT odist, enum storage_fmt ofmt,
+			   int sign)
+{
+     problem_half *ego;
+
+     A(n > 0 && vl > 0);
+     A(kind == HALF_DFT || kind == HALF_R2C || kind == HALF_C2R);
+
+     /* In place, every transform is loaded before it is stored over,
+	which only works if the input and output elements coincide. */
+     if (I == O && (kind != HALF_DFT || ifmt != ofmt
+		    || is != os || idist != odist))
+	  return X(mkproblem_unsolvable)();
+
+     ego = (problem_half *)X(mkproblem)(sizeof(problem_half), &padt);
+
+     ego->kind = kind;
+     ego->sign = (kind == HALF_DFT) ? sign : 0;
+     ego->n = n;
+     ego->vl = vl;
+     ego->I = I;
+     ego->is = is;
+     ego->idist = idist;
+     ego->ifmt = ifmt;
+     ego->O = O;
+     ego->os = os;
+     ego->odist = odist;
+     ego->ofmt = ofmt;
+
+     return &(ego->super);
+}
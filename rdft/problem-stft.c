@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "rdft/rdft.h"
+
+static void destroy(problem *ego_)
+{
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_stft *p = (const problem_stft *) p_;
+     X(md5puts)(m, "stft");
+     X(md5INT)(m, p->n);
+     X(md5INT)(m, p->hop);
+     X(md5INT)(m, p->nframes);
+     X(md5INT)(m, p->ring);
+     X(md5int)(m, p->w != 0);
+     X(md5INT)(m, p->ci - p->cr);
+     X(md5INT)(m, p->os);
+     X(md5INT)(m, p->odist);
+     X(md5int)(m, X(ialignment_of)(p->cr));
+     X(md5int)(m, X(ialignment_of)(p->ci));
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_stft *ego = (const problem_stft *) ego_;
+     p->print(p, "(stft %D %D %D %D %d %D %D %D)", 
+	      ego->n, ego->hop, ego->nframes, ego->ring, ego->w != 0,
+	      (INT)(ego->ci - ego->cr), ego->os, ego->odist);
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_stft *ego = (const problem_stft *) ego_;
+     R *in = UNTAINT(ego->in);
+     INT i;
+
+     for (i = 0; i < ego->ring; ++i) 
+	  in[i] = K(0.0);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_STFT,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_stft)(INT n, INT hop, INT nframes,
+			   INT ring, R *in, INT pos, const R *w,
+			   R *cr, R *ci, INT os, INT odist)
+{
+     problem_stft *ego;
+
+     A(n > 0 && hop > 0 && nframes > 0);
+     A(n <= ring);
+
+     ego = (problem_stft *)X(mkproblem)(sizeof(problem_stft), &padt);
+
+     ego->n = n;
+     ego->hop = hop;
+     ego->nframes = nframes;
+     ego->ring = ring;
+     ego->pos = pos;
+     ego->in = in;
+     ego->w = w;
+     ego->cr = cr;
+     ego->ci = ci;
+     ego->os = os;
+     ego->odist = odist;
+
+     return &(ego->super);
+}
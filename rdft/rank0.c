@@ -190,6 +190,51 @@ static void apply_tiledbuf(const plan *ego_, R *I, R *O)
 
 #define applicable_tiledbuf applicable_tiled
 
+/**************************************************************/
+/* out of place, non-temporal stores */
+
+/* copies smaller than this (in bytes) are assumed to fit in the
+   last-level cache, where streaming the output only hurts */
+#define NONTEMPORAL_MIN (1 << 21)
+
+static void apply_nt(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+
+     switch (ego->rnk) {
+	 case 0:
+	      X(cpy2d_nt)(I, O, 1, 0, 0, 1, 0, 0, ego->vl);
+	      break;
+	 case 1:
+	      X(cpy2d_nt)(I, O,
+			  ego->d[0].n, ego->d[0].is, ego->d[0].os,
+			  1, 0, 0,
+			  ego->vl);
+	      break;
+	 default:
+	      copy(ego->d, ego->rnk, ego->vl, I, O, X(cpy2d_nt));
+	      break;
+     }
+}
+
+static int applicable_nt(const P *pln, const problem_rdft *p)
+{
+     int i;
+
+     if (!(1
+	   && p->I != p->O
+	   && X(tensor_sz)(p->vecsz) * (INT)sizeof(R) >= NONTEMPORAL_MIN
+	   && X(cpy2d_nt_ok)(p->I, p->O, 0, 0, 0, 0, pln->vl)))
+	  return 0;
+
+     for (i = 0; i < pln->rnk; ++i)
+	  if (!X(cpy2d_nt_ok)(p->I, p->O, pln->d[i].is, pln->d[i].os,
+			      0, 0, pln->vl))
+	       return 0;
+
+     return 1;
+}
+
 /**************************************************************/
 /* rank 0, out of place, using memcpy */
 static void apply_memcpy(const plan *ego_, R *I, R *O)
@@ -350,6 +395,9 @@ void X(rdft_rank0_register)(planner *p)
 	  int (*applicable)(const P *, const problem_rdft *);
 	  const char *nam;
      } tab[] = {
+	  /* registered first so that it never wins a tie in
+	     ESTIMATE mode: streaming is only chosen by measurement */
+	  { apply_nt,       applicable_nt,       "rdft-rank0-nt" },
 	  { apply_memcpy,   applicable_memcpy,   "rdft-rank0-memcpy" },
 	  { apply_memcpy_loop,   applicable_memcpy_loop,  
 	    "rdft-rank0-memcpy-loop" },
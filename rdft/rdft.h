@@ -93,6 +93,14 @@ void X(dft_r2hc_register)(planner *p);
 void X(rdft_nop_register)(planner *p);
 void X(hc2hc_generic_register)(planner *p);
 
+/* hcpairs.c: loops over the {i, n - i} pairs of halfcomplex arrays */
+void X(hc_rotate)(INT n, const R *a, INT as, const R *b, INT bs,
+		  R *c, INT cs, R *d, INT ds, const R *W,
+		  int sumdiff, R cscale, R dscale);
+void X(hc_unfold)(INT n, const R *buf, R *O, INT os, const R *W, R sgn);
+void X(hc_copy)(INT n, const R *a, INT as, const R *b, INT bs,
+		R *c, INT cs, R *d, INT ds);
+
 /****************************************************************************/
 /* problem2.c: */
 /* 
@@ -153,6 +161,124 @@ plan *X(mkplan_rdft2)(size_t size, const plan_adt *adt, rdft2apply apply);
 #define MKPLAN_RDFT2(type, adt, apply) \
   (type *)X(mkplan_rdft2)(sizeof(type), adt, apply)
 
+/* problem-stft.c: short-time Fourier transform of a ring buffer.
+   Frame f is made of the N samples of IN that start at index
+   (POS + f HOP) mod RING, multiplied by the window W (if W != 0).
+   Its R2HC transform is stored at CR + f ODIST, CI + f ODIST,
+   with stride OS. */
+typedef struct {
+     problem super;
+     INT n, hop, nframes;
+     INT ring, pos;
+     R *in;
+     const R *w;
+     R *cr, *ci;
+     INT os, odist;
+} problem_stft;
+
+problem *X(mkproblem_stft)(INT n, INT hop, INT nframes,
+			   INT ring, R *in, INT pos, const R *w,
+			   R *cr, R *ci, INT os, INT odist);
+
+/* solve-stft.c: */
+void X(stft_solve)(const plan *ego_, const problem *p_);
+
+/* plan-stft.c: */
+typedef void (*stftapply) (const plan *ego, R *in, INT pos, R *cr, R *ci);
+
+typedef struct {
+     plan super;
+     stftapply apply;
+} plan_stft;
+
+plan *X(mkplan_stft)(size_t size, const plan_adt *adt, stftapply apply);
+
+#define MKPLAN_STFT(type, adt, apply) \
+  (type *)X(mkplan_stft)(sizeof(type), adt, apply)
+
+/* plan-stream.c: plans that carry NSTATE reals of state from one
+   execution to the next, such as streaming FIR filters.  APPLY reads
+   and updates STATE, which the caller may own; X(execute) uses the
+   plan's own STATE, allocated and zeroed when the plan is awake. */
+typedef void (*streamapply) (const plan *ego, R *state, R *I, R *O);
+
+typedef struct {
+     plan super;
+     streamapply apply;
+     INT nstate;
+     R *state;
+} plan_stream;
+
+plan *X(mkplan_stream)(size_t size, const plan_adt *adt, 
+		       streamapply apply, INT nstate);
+void X(stream_awake)(plan_stream *ego, enum wakefulness wakefulness);
+
+#define MKPLAN_STREAM(type, adt, apply, nstate) \
+  (type *)X(mkplan_stream)(sizeof(type), adt, apply, nstate)
+
+/* problem-fir.c: streaming FIR filter.  Each execution consumes
+   BLOCK samples of IN and produces the next BLOCK samples of the
+   convolution of the stream with the NTAPS taps H in OUT; the
+   history of the stream is the state of a plan_stream. */
+typedef struct {
+     problem super;
+     INT ntaps, block;
+     const R *h;
+     R *in, *out;
+} problem_fir;
+
+problem *X(mkproblem_fir)(INT ntaps, const R *h, INT block, R *in, R *out);
+
+/* solve-fir.c: */
+void X(fir_solve)(const plan *ego_, const problem *p_);
+
+/* problem-half.c: VL one-dimensional transforms of size N whose
+   input and output arrays are stored in the formats IFMT and OFMT,
+   computed in R.  KIND is HALF_DFT (complex DFT of sign SIGN),
+   HALF_R2C or HALF_C2R; complex arrays are interleaved.  Strides and
+   distances count real numbers of the respective format, so that
+   element i of transform v of a complex input starts at number
+   i IS + v IDIST of I. */
+enum { HALF_DFT, HALF_R2C, HALF_C2R };
+
+typedef struct {
+     problem super;
+     int kind, sign;
+     INT n, vl;
+     void *I, *O;
+     INT is, idist, os, odist;
+     enum storage_fmt ifmt, ofmt;
+} problem_half;
+
+problem *X(mkproblem_half)(int kind, INT n, INT vl,
+			   void *I, INT is, INT idist, enum storage_fmt ifmt,
+			   void *O, INT os, INT odist, enum storage_fmt ofmt,
+			   int sign);
+void X(half_sizes)(const problem_half *p, INT *ni, INT *mi, 
+		   INT *no, INT *mo);
+
+/* solve-half.c: */
+void X(half_solve)(const plan *ego_, const problem *p_);
+
+/* plan-half.c: */
+typedef void (*halfapply) (const plan *ego, void *I, void *O);
+
+typedef struct {
+     plan super;
+     halfapply apply;
+} plan_half;
+
+plan *X(mkplan_half)(size_t size, const plan_adt *adt, halfapply apply);
+
+#define MKPLAN_HALF(type, adt, apply) \
+  (type *)X(mkplan_half)(sizeof(type), adt, apply)
+
+/* rdft/simd/<isa>/storage.c: SIMD conversions for half.c, or null if
+   the ISA has none for FMT */
+const storage_cvt *X(storage_cvt_avx2)(enum storage_fmt fmt);
+const storage_cvt *X(storage_cvt_avx512)(enum storage_fmt fmt);
+void X(store_bf16_avx512)(void *O, const R *I, INT n);
+
 /* various solvers */
 
 solver *X(mksolver_rdft2_direct)(kr2c k, const kr2c_desc *desc);
@@ -163,11 +289,15 @@ void X(rdft2_rdft_register)(planner *p);
 void X(rdft2_nop_register)(planner *p);
 void X(rdft2_rank0_register)(planner *p);
 void X(rdft2_rank_geq2_register)(planner *p);
+void X(stft_register)(planner *p);
+void X(fir_register)(planner *p);
+void X(half_register)(planner *p);
 
 /****************************************************************************/
 
 /* configurations */
 void X(rdft_conf_standard)(planner *p);
+void X(rdft_conf_dft)(planner *p);
 
 #ifdef __cplusplus
 }  /* extern "C" */
@@ -41,36 +41,26 @@ typedef struct {
 /* copy halfcomplex array r (contiguous) to complex (strided) array rio/iio. */
 static void hc2c(INT n, R *r, R *rio, R *iio, INT os)
 {
-     INT i;
-
      rio[0] = r[0];
      iio[0] = 0;
 
-     for (i = 1; i + i < n; ++i) {
-	  rio[i * os] = r[i];
-	  iio[i * os] = r[n - i];
-     }
+     X(hc_copy)(n, r, 1, r + n, -1, rio, os, iio, os);
 
-     if (i + i == n) {	/* store the Nyquist frequency */
-	  rio[i * os] = r[i];
-	  iio[i * os] = K(0.0);
+     if (n % 2 == 0) {	/* store the Nyquist frequency */
+	  rio[(n / 2) * os] = r[n / 2];
+	  iio[(n / 2) * os] = K(0.0);
      }
 }
 
 /* reverse of hc2c */
 static void c2hc(INT n, R *rio, R *iio, INT is, R *r)
 {
-     INT i;
-
      r[0] = rio[0];
 
-     for (i = 1; i + i < n; ++i) {
-	  r[i] = rio[i * is];
-	  r[n - i] = iio[i * is];
-     }
+     X(hc_copy)(n, rio, is, iio, is, r, 1, r + n, -1);
 
-     if (i + i == n)		/* store the Nyquist frequency */
-	  r[i] = rio[i * is];
+     if (n % 2 == 0)		/* store the Nyquist frequency */
+	  r[n / 2] = rio[(n / 2) * is];
 }
 
 /***************************************************************************/
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* conversions between R and FP16 for the half-precision solver (see
+   rdft/half.c), eight numbers at a time with F16C.  Every processor
+   with AVX2 has F16C, and the build adds -mf16c to the AVX2 flags. */
+
+#include "kernel/ifftw.h"
+#include "rdft/rdft.h"
+
+#if defined(__F16C__)
+#include <immintrin.h>
+
+typedef unsigned short h16;
+
+static void load_fp16(R *O, const void *I_, INT n)
+{
+     const h16 *I = (const h16 *) I_;
+     INT i;
+
+     for (i = 0; i + 8 <= n; i += 8) {
+	  __m256 x = _mm256_cvtph_ps(
+	       _mm_loadu_si128((const __m128i *)(I + i)));
+#if defined(FFTW_SINGLE)
+	  _mm256_storeu_ps(O + i, x);
+#else
+	  _mm256_storeu_pd(O + i, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+	  _mm256_storeu_pd(O + i + 4,
+			   _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+#endif
+     }
+     X(storage_load)(O + i, 1, I + i, 1, n - i, FMT_FP16);
+}
+
+static void store_fp16(void *O_, const R *I, INT n)
+{
+     h16 *O = (h16 *) O_;
+     INT i;
+
+     for (i = 0; i + 8 <= n; i += 8) {
+#if defined(FFTW_SINGLE)
+	  __m256 x = _mm256_loadu_ps(I + i);
+#else
+	  __m256 x = _mm256_insertf128_ps(
+	       _mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(I + i))),
+	       _mm256_cvtpd_ps(_mm256_loadu_pd(I + i + 4)), 1);
+#endif
+	  _mm_storeu_si128((__m128i *)(O + i),
+			   _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+     }
+     X(storage_store)(O + i, 1, I + i, 1, n - i, FMT_FP16);
+}
+
+const storage_cvt *X(storage_cvt_avx2)(enum storage_fmt fmt)
+{
+     static const storage_cvt fp16 = { load_fp16, store_fp16 };
+     return fmt == FMT_FP16 ? &fp16 : 0;
+}
+
+#else /* !__F16C__ */
+
+const storage_cvt *X(storage_cvt_avx2)(enum storage_fmt fmt)
+{
+     UNUSED(fmt);
+     return 0;
+}
+
+#endif
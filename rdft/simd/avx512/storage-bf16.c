@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* stores to BF16 with VCVTNEPS2BF16, which rounds to nearest even like
+   the scalar code but flushes floats below 2^-126 in magnitude to
+   zero.  This file alone is compiled with -mavx512bf16, and is only
+   used when X(have_simd_avx512_bf16) says so. */
+
+#include "kernel/ifftw.h"
+#include "rdft/rdft.h"
+
+#if defined(__AVX512BF16__)
+#include <immintrin.h>
+
+void X(store_bf16_avx512)(void *O_, const R *I, INT n)
+{
+     unsigned short *O = (unsigned short *) O_;
+     INT i;
+
+     for (i = 0; i + 16 <= n; i += 16) {
+#if defined(FFTW_SINGLE)
+	  __m512 x = _mm512_loadu_ps(I + i);
+#else
+	  __m256 lo = _mm512_cvtpd_ps(_mm512_loadu_pd(I + i));
+	  __m256 hi = _mm512_cvtpd_ps(_mm512_loadu_pd(I + i + 8));
+	  __m512 x = _mm512_castpd_ps(
+	       _mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)),
+				  _mm256_castps_pd(hi), 1));
+#endif
+	  _mm256_storeu_si256((__m256i *)(O + i),
+			      (__m256i) _mm512_cvtneps_pbh(x));
+     }
+     X(storage_store)(O + i, 1, I + i, 1, n - i, FMT_BF16);
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* conversions between R and the 16-bit formats for the half-precision
+   solver (see rdft/half.c), sixteen numbers at a time with AVX-512F.
+   Stores to BF16 round in scalar code unless the processor has
+   AVX512_BF16, see storage-bf16.c. */
+
+#include "kernel/ifftw.h"
+#include "rdft/rdft.h"
+
+#include <immintrin.h>
+
+typedef unsigned short h16;
+
+/* sixteen floats into O */
+static inline void st16(R *O, __m512 x)
+{
+#if defined(FFTW_SINGLE)
+     _mm512_storeu_ps(O, x);
+#else
+     _mm512_storeu_pd(O, _mm512_cvtps_pd(_mm512_castps512_ps256(x)));
+     _mm512_storeu_pd(O + 8, _mm512_cvtps_pd(_mm256_castpd_ps(
+			   _mm512_extractf64x4_pd(_mm512_castps_pd(x), 1))));
+#endif
+}
+
+/* sixteen floats from I */
+static inline __m512 ld16(const R *I)
+{
+#if defined(FFTW_SINGLE)
+     return _mm512_loadu_ps(I);
+#else
+     __m256 lo = _mm512_cvtpd_ps(_mm512_loadu_pd(I));
+     __m256 hi = _mm512_cvtpd_ps(_mm512_loadu_pd(I + 8));
+     return _mm512_castpd_ps(
+	  _mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)),
+			     _mm256_castps_pd(hi), 1));
+#endif
+}
+
+static void load_fp16(R *O, const void *I_, INT n)
+{
+     const h16 *I = (const h16 *) I_;
+     INT i;
+
+     for (i = 0; i + 16 <= n; i += 16)
+	  st16(O + i, _mm512_cvtph_ps(
+		    _mm256_loadu_si256((const __m256i *)(I + i))));
+     X(storage_load)(O + i, 1, I + i, 1, n - i, FMT_FP16);
+}
+
+static void store_fp16(void *O_, const R *I, INT n)
+{
+     h16 *O = (h16 *) O_;
+     INT i;
+
+     for (i = 0; i + 16 <= n; i += 16)
+	  _mm256_storeu_si256((__m256i *)(O + i),
+			      _mm512_cvtps_ph(ld16(I + i),
+					      _MM_FROUND_TO_NEAREST_INT));
+     X(storage_store)(O + i, 1, I + i, 1, n - i, FMT_FP16);
+}
+
+/* BF16 is the upper half of a float, so loads are exact shifts */
+static void load_bf16(R *O, const void *I_, INT n)
+{
+     const h16 *I = (const h16 *) I_;
+     INT i;
+
+     for (i = 0; i + 16 <= n; i += 16) {
+	  __m512i x = _mm512_cvtepu16_epi32(
+	       _mm256_loadu_si256((const __m256i *)(I + i)));
+	  st16(O + i, _mm512_castsi512_ps(_mm512_slli_epi32(x, 16)));
+     }
+     X(storage_load)(O + i, 1, I + i, 1, n - i, FMT_BF16);
+}
+
+static void store_bf16(void *O, const R *I, INT n)
+{
+     X(storage_store)(O, 1, I, 1, n, FMT_BF16);
+}
+
+const storage_cvt *X(storage_cvt_avx512)(enum storage_fmt fmt)
+{
+     static const storage_cvt fp16 = { load_fp16, store_fp16 };
+     static const storage_cvt bf16 = { load_bf16, store_bf16 };
+#if HAVE_AVX512_BF16
+     static const storage_cvt bf16_ne = { load_bf16, X(store_bf16_avx512) };
+#endif
+
+     switch (fmt) {
+	 case FMT_FP16:
+	      return &fp16;
+	 case FMT_BF16:
+#if HAVE_AVX512_BF16
+	      if (X(have_simd_avx512_bf16)())
+		   return &bf16_ne;
+#endif
+	      return &bf16;
+	 default:
+	      return 0;
+     }
+}
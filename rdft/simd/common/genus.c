@@ -31,7 +31,9 @@ static int hc2cbv_okp(const R *Rp, const R *Ip, const R *Rm, const R *Im,
 	     && !NO_SIMDP(plnr)
 	     && SIMD_STRIDE_OK(rs)
 	     && SIMD_VSTRIDE_OK(ms)
+#ifndef SIMD_MASKED_TAIL
              && ((me - mb) % VL) == 0
+#endif
              && ((mb - 1) % VL) == 0 /* twiddle factors alignment */
 	     && ALIGNED(Rp)
 	     && ALIGNED(Rm)
@@ -49,7 +51,9 @@ static int hc2cfv_okp(const R *Rp, const R *Ip, const R *Rm, const R *Im,
 	     && !NO_SIMDP(plnr)
 	     && SIMD_STRIDE_OK(rs)
 	     && SIMD_VSTRIDE_OK(ms)
+#ifndef SIMD_MASKED_TAIL
              && ((me - mb) % VL) == 0
+#endif
              && ((mb - 1) % VL) == 0 /* twiddle factors alignment */
 	     && ALIGNED(Rp)
 	     && ALIGNED(Rm)
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Short-time Fourier transform of a ring buffer of samples.
+
+   Frames are transformed in batches of NBUF by a single rdft2 plan
+   with a vector loop over the batch, which the planner solves with
+   the usual vrank-geq1/buffered rdft2 solvers.  Each batch is
+   gathered into a buffer, unwrapping the ring and multiplying by the
+   window in the same pass.  Without a window, a batch that does not
+   wrap around the end of the ring is transformed directly from the
+   ring, viewing the overlapping frames as a vector of stride HOP. */
+
+#include "rdft/rdft.h"
+
+typedef struct {
+     solver super;
+     size_t maxnbuf_ndx;
+} S;
+
+static const INT maxnbufs[] = { 8, 64 };
+
+typedef struct {
+     plan_stft super;
+
+     plan *cld, *cldrest;       /* transforms of the buffer */
+     plan *cldz, *cldzrest;     /* transforms in the ring, or 0 */
+     R *w;
+     INT n, hop, nframes, ring;
+     INT nbuf, bufdist, odist;
+} P;
+
+/* copy NF frames starting at S into BUF, times the window */
+static void gather(const P *ego, const R *in, INT s, INT nf, R *buf)
+{
+     INT f, t, k, n = ego->n, hop = ego->hop, ring = ego->ring;
+     const R *w = ego->w;
+
+     for (f = 0; f < nf; ++f, buf += ego->bufdist) {
+	  /* samples before the end of the ring */
+	  k = X(imin)(n, ring - s);
+	  if (w) {
+	       for (t = 0; t < k; ++t) buf[t] = in[s + t] * w[t];
+	       for (; t < n; ++t) buf[t] = in[t - k] * w[t];
+	  } else {
+	       for (t = 0; t < k; ++t) buf[t] = in[s + t];
+	       for (; t < n; ++t) buf[t] = in[t - k];
+	  }
+	  s = (s + hop) % ring;
+     }
+}
+
+/* transform NF frames starting at S, with CLD on the buffer or
+   with CLDZ in place in the ring */
+static void batch(const P *ego, plan *cld, plan *cldz, R *in, INT s,
+		  INT nf, R *bufs, R *cr, R *ci)
+{
+     if (cldz && s + (nf - 1) * ego->hop + ego->n <= ego->ring) {
+	  plan_rdft2 *cldz_ = (plan_rdft2 *) cldz;
+	  cldz_->apply(cldz, in + s, in + s + 1, cr, ci);
+     } else {
+	  plan_rdft2 *cld_ = (plan_rdft2 *) cld;
+	  gather(ego, in, s, nf, bufs);
+	  cld_->apply(cld, bufs, bufs + 1, cr, ci);
+     }
+}
+
+static void apply(const plan *ego_, R *in, INT pos, R *cr, R *ci)
+{
+     const P *ego = (const P *) ego_;
+     INT f, nbuf = ego->nbuf, nframes = ego->nframes, ring = ego->ring;
+     INT s = X(modulo)(pos, ring);
+     INT step = (nbuf * ego->hop) % ring, ovs_by_nbuf = nbuf * ego->odist;
+     R *bufs = (R *)MALLOC(sizeof(R) * nbuf * ego->bufdist, BUFFERS);
+
+     for (f = nbuf; f <= nframes; f += nbuf) {
+	  batch(ego, ego->cld, ego->cldz, in, s, nbuf, bufs, cr, ci);
+	  s = (s + step) % ring;
+	  cr += ovs_by_nbuf; ci += ovs_by_nbuf;
+     }
+
+     /* Do the remaining frames, if any: */
+     if (nframes % nbuf)
+	  batch(ego, ego->cldrest, ego->cldzrest, in, s, nframes % nbuf,
+		bufs, cr, ci);
+
+     X(ifree)(bufs);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cldrest, wakefulness);
+     X(plan_awake)(ego->cldz, wakefulness);
+     X(plan_awake)(ego->cldzrest, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(ifree0)(ego->w);
+     X(plan_destroy_internal)(ego->cldzrest);
+     X(plan_destroy_internal)(ego->cldz);
+     X(plan_destroy_internal)(ego->cldrest);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(stft-%D%v/%D-%D%s%(%p%)%(%p%)%(%p%)%(%p%))",
+              ego->n, ego->nbuf, ego->nframes, ego->hop,
+	      ego->w ? "-windowed" : "",
+              ego->cld, ego->cldrest, ego->cldz, ego->cldzrest);
+}
+
+static int applicable(const S *ego, const problem *p_, const planner *plnr)
+{
+     const problem_stft *p = (const problem_stft *) p_;
+
+     if (X(toobig)(p->n) && CONSERVE_MEMORYP(plnr))
+	  return 0;
+
+     /* if this solver is redundant, in the sense that a solver
+	of lower index generates the same plan, then prune this
+	solver */
+     if (X(nbuf_redundant)(p->n, p->nframes,
+			   ego->maxnbuf_ndx, maxnbufs, NELEM(maxnbufs)))
+	  return 0;
+
+     return 1;
+}
+
+/* r2c transforms of NF frames of size N with input vector stride IVS,
+   from R */
+static problem *mkcld(const problem_stft *p, INT nf, INT ivs, R *r, 
+		      R *cr, R *ci)
+{
+     return X(mkproblem_rdft2_d_3pointers)(
+	  X(mktensor_1d)(p->n, 1, p->os),
+	  X(mktensor_1d)(nf, ivs, p->odist),
+	  r, cr, ci, R2HC);
+}
+
+/* whether NF frames can be contiguous in the ring */
+static int fits(const problem_stft *p, INT nf)
+{
+     return nf > 0 && (nf - 1) * p->hop + p->n <= p->ring;
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     const S *ego = (const S *) ego_;
+     const problem_stft *p = (const problem_stft *) p_;
+     P *pln;
+     plan *cld = 0, *cldrest = 0, *cldz = 0, *cldzrest = 0;
+     R *bufs = (R *) 0, *w = (R *) 0;
+     INT i, n, nframes, nbuf, bufdist, od;
+
+     static const plan_adt padt = {
+	  X(stft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego, p_, plnr))
+          return (plan *) 0;
+
+     n = p->n;
+     nframes = p->nframes;
+     nbuf = X(nbuf)(n, nframes, maxnbufs[ego->maxnbuf_ndx]);
+     bufdist = X(bufdist)(n, nbuf);
+     od = p->odist * (nbuf * (nframes / nbuf));
+
+     /* initial allocation for the purpose of planning */
+     bufs = (R *) MALLOC(sizeof(R) * nbuf * bufdist, BUFFERS);
+
+     /* the buffer is ours, and can be destroyed */
+     cld = X(mkplan_d)(plnr, 
+		       mkcld(p, nbuf, bufdist, bufs,
+			     TAINT(p->cr, p->odist * nbuf),
+			     TAINT(p->ci, p->odist * nbuf)));
+     if (!cld) goto nada;
+
+     cldrest = X(mkplan_d)(plnr, 
+			   mkcld(p, nframes % nbuf, bufdist, bufs,
+				 p->cr + od, p->ci + od));
+     if (!cldrest) goto nada;
+
+     X(ifree)(bufs); bufs = 0;
+
+     if (!p->w) {
+	  /* Frames overlap, so the ring must not be destroyed.  The
+	     position in the ring is only known at execution time,
+	     hence the input alignment is unknown.  A batch that never
+	     fits in the ring is always gathered. */
+	  if (fits(p, nbuf)) {
+	       cldz = X(mkplan_f_d)(plnr,
+				    mkcld(p, nbuf, p->hop, TAINT(p->in, 1),
+					  TAINT(p->cr, p->odist * nbuf),
+					  TAINT(p->ci, p->odist * nbuf)),
+				    NO_DESTROY_INPUT, 0, 0);
+	       if (!cldz) goto nada;
+	  }
+
+	  if (fits(p, nframes % nbuf)) {
+	       cldzrest = X(mkplan_f_d)(plnr,
+					mkcld(p, nframes % nbuf, p->hop, 
+					      TAINT(p->in, 1),
+					      p->cr + od, p->ci + od),
+					NO_DESTROY_INPUT, 0, 0);
+	       if (!cldzrest) goto nada;
+	  }
+     } else {
+	  w = (R *) MALLOC(sizeof(R) * n, TWIDDLES);
+	  for (i = 0; i < n; ++i) 
+	       w[i] = p->w[i];
+     }
+
+     pln = MKPLAN_STFT(P, &padt, apply);
+     pln->cld = cld;
+     pln->cldrest = cldrest;
+     pln->cldz = cldz;
+     pln->cldzrest = cldzrest;
+     pln->w = w;
+     pln->n = n;
+     pln->hop = p->hop;
+     pln->nframes = nframes;
+     pln->ring = p->ring;
+     pln->nbuf = nbuf;
+     pln->bufdist = bufdist;
+     pln->odist = p->odist;
+
+     /* cost of the gathering path, which is always possible */
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(nframes / nbuf, &cld->ops, &pln->super.super.ops);
+     X(ops_add2)(&cldrest->ops, &pln->super.super.ops);
+     pln->super.super.ops.other += n * nframes;
+     if (w) 
+	  pln->super.super.ops.mul += n * nframes;
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree0)(w);
+     X(ifree0)(bufs);
+     X(plan_destroy_internal)(cldzrest);
+     X(plan_destroy_internal)(cldz);
+     X(plan_destroy_internal)(cldrest);
+     X(plan_destroy_internal)(cld);
+     return (plan *) 0;
+}
+
+static solver *mksolver(size_t maxnbuf_ndx)
+{
+     static const solver_adt sadt = { PROBLEM_STFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     slv->maxnbuf_ndx = maxnbuf_ndx;
+     return &(slv->super);
+}
+
+void X(stft_register)(planner *p)
+{
+     size_t i;
+     for (i = 0; i < NELEM(maxnbufs); ++i)
+	  REGISTER_SOLVER(p, mksolver(i));
+}
@@ -33,8 +33,10 @@ static const solvtab s =
      SOLVTAB(X(rodft00e_r2hc_pad_register)),
      SOLVTAB(X(reodft00e_splitradix_register)),
      SOLVTAB(X(reodft010e_r2hc_register)),
+     SOLVTAB(X(reodft010e_radix2_register)),
      SOLVTAB(X(reodft11e_radix2_r2hc_register)),
      SOLVTAB(X(reodft11e_r2hc_odd_register)),
+     SOLVTAB(X(mdct_register)),
 
      SOLVTAB_END
 };
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* MDCT and IMDCT of even size N via a REDFT11 (DCT-IV) of size N.
+   Split the 2N windowed inputs into quarters (a, b, c, d) of N/2
+   numbers; then
+
+      MDCT(a, b, c, d) = DCT-IV(-c_r - d, a - b_r),
+
+   where r denotes reversal, and DCT-IV = REDFT11 / 2.  The IMDCT is
+   the transpose: a DCT-IV followed by the transposed unfolding, which
+   yields the (anti)symmetric extension of the two halves.  The window,
+   the factor 1/2 and, for the IMDCT, the overlap-add with the second
+   half of the previous output are all fused into the folding pass.
+   That second half is the state of the plan, which the caller may own
+   (see X(execute_mdct)). */
+
+#include "reodft/reodft.h"
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_stream super;
+     plan *cld;
+     INT n;
+     R *w;       /* window, times 1/2 */
+     int ola;
+} P;
+
+static void apply_mdct(const plan *ego_, R *tail, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     INT j, n = ego->n, h = n / 2;
+     const R *w = ego->w;
+     R *buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     UNUSED(tail);
+     for (j = 0; j < h; ++j) {
+	  buf[j] = -(I[3*h - 1 - j] * w[3*h - 1 - j] 
+		     + I[3*h + j] * w[3*h + j]);
+	  buf[h + j] = I[j] * w[j] - I[n - 1 - j] * w[n - 1 - j];
+     }
+
+     cld->apply((plan *) cld, buf, O);
+
+     X(ifree)(buf);
+}
+
+/* TAIL is the second half of the previous output, for overlap-add */
+static void apply_imdct(const plan *ego_, R *tail, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     INT j, n = ego->n, h = n / 2;
+     const R *w = ego->w;
+     R *buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     cld->apply((plan *) cld, I, buf);
+
+     if (ego->ola) {
+	  for (j = 0; j < h; ++j) {
+	       E a = buf[h + j];
+	       O[j] = a * w[j] + tail[j];
+	       O[n - 1 - j] = tail[n - 1 - j] - a * w[n - 1 - j];
+	  }
+	  for (j = 0; j < h; ++j) {
+	       E b = buf[j];
+	       tail[h - 1 - j] = -b * w[3*h - 1 - j];
+	       tail[h + j] = -b * w[3*h + j];
+	  }
+     } else {
+	  for (j = 0; j < h; ++j) {
+	       E a = buf[h + j], b = buf[j];
+	       O[j] = a * w[j];
+	       O[n - 1 - j] = -a * w[n - 1 - j];
+	       O[3*h - 1 - j] = -b * w[3*h - 1 - j];
+	       O[3*h + j] = -b * w[3*h + j];
+	  }
+     }
+
+     X(ifree)(buf);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+
+     X(plan_awake)(ego->cld, wakefulness);
+
+     /* the stream starts with silence */
+     X(stream_awake)(&ego->super, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(ifree0)(ego->w);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(%s-%D%s%(%p%))",
+	      ego->super.apply == apply_mdct ? "mdct" : "imdct",
+	      ego->n, ego->ola ? "-ola" : "", ego->cld);
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     P *pln;
+     const problem_mdct *p = (const problem_mdct *) p_;
+     plan *cld;
+     R *buf, *w;
+     INT i, n = p->n;
+     opcnt ops;
+
+     static const plan_adt padt = {
+	  X(mdct_solve), awake, print, destroy
+     };
+
+     UNUSED(ego_);
+
+     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     if (p->inverse)
+	  cld = X(mkplan_d)(plnr, 
+			    X(mkproblem_rdft_1_d)(X(mktensor_1d)(n, 1, 1),
+						  X(mktensor_0d)(),
+						  p->I, buf, REDFT11));
+     else
+	  /* the buffer is ours, and can be destroyed */
+	  cld = X(mkplan_f_d)(plnr, 
+			      X(mkproblem_rdft_1_d)(X(mktensor_1d)(n, 1, 1),
+						    X(mktensor_0d)(),
+						    buf, p->O, REDFT11),
+			      0, 0, NO_DESTROY_INPUT);
+     X(ifree)(buf);
+     if (!cld)
+          return (plan *)0;
+
+     w = (R *) MALLOC(sizeof(R) * 2 * n, TWIDDLES);
+     for (i = 0; i < 2 * n; ++i)
+	  w[i] = p->w ? K(0.5) * p->w[i] : K(0.5);
+
+     pln = MKPLAN_STREAM(P, &padt, p->inverse ? apply_imdct : apply_mdct,
+			 p->ola ? n : 0);
+     pln->n = n;
+     pln->cld = cld;
+     pln->w = w;
+     pln->ola = p->ola;
+
+     X(ops_zero)(&ops);
+     ops.add = n + (p->ola ? n : 0);
+     ops.mul = 2 * n;
+     ops.other = 4 * n;
+
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_add)(&ops, &cld->ops, &pln->super.super.ops);
+
+     return &(pln->super.super);
+}
+
+/* constructor */
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_MDCT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(mdct_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
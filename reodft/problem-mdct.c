@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "reodft/reodft.h"
+
+static void destroy(problem *ego_)
+{
+     X(ifree)(ego_);
+}
+
+static void hash(const problem *p_, md5 *m)
+{
+     const problem_mdct *p = (const problem_mdct *) p_;
+     X(md5puts)(m, "mdct");
+     X(md5INT)(m, p->n);
+     X(md5int)(m, p->inverse);
+     X(md5int)(m, p->ola);
+     X(md5int)(m, p->w != 0);
+     X(md5int)(m, X(ialignment_of)(p->I));
+     X(md5int)(m, X(ialignment_of)(p->O));
+}
+
+static void print(const problem *ego_, printer *p)
+{
+     const problem_mdct *ego = (const problem_mdct *) ego_;
+     p->print(p, "(mdct %D %d %d %d)", 
+	      ego->n, ego->inverse, ego->ola, ego->w != 0);
+}
+
+static void zero(const problem *ego_)
+{
+     const problem_mdct *ego = (const problem_mdct *) ego_;
+     R *I = UNTAINT(ego->I);
+     INT i, n = ego->inverse ? ego->n : 2 * ego->n;
+
+     for (i = 0; i < n; ++i) 
+	  I[i] = K(0.0);
+}
+
+static const problem_adt padt =
+{
+     PROBLEM_MDCT,
+     hash,
+     zero,
+     print,
+     destroy
+};
+
+problem *X(mkproblem_mdct)(INT n, int inverse, int ola, 
+			   R *I, R *O, const R *w)
+{
+     problem_mdct *ego;
+
+     A(n > 0 && n % 2 == 0);
+     A(inverse || !ola);
+
+     ego = (problem_mdct *)X(mkproblem)(sizeof(problem_mdct), &padt);
+
+     ego->n = n;
+     ego->inverse = inverse;
+     ego->ola = ola;
+     ego->I = I;
+     ego->O = O;
+     ego->w = w;
+
+     return &(ego->super);
+}
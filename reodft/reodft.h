@@ -26,15 +26,40 @@
 
 #define REODFT_KINDP(k) ((k) >= REDFT00 && (k) <= RODFT11)
 
+/* problem-mdct.c: MDCT of 2N inputs into N outputs,
+
+      X[k] = sum_{j<2N} w[j] x[j] cos(pi/N (j + 1/2 + N/2) (k + 1/2)),
+
+   for even N, or its transpose (the IMDCT) if INVERSE, optionally
+   windowed by W[0..2N-1] (W = 0 means no window).  If OLA, the IMDCT
+   overlap-adds its 2N outputs with the second half of those of the
+   previous execution, the state of a plan_stream, and only outputs
+   N samples. */
+typedef struct {
+     problem super;
+     INT n;
+     int inverse, ola;
+     R *I, *O;
+     const R *w;
+} problem_mdct;
+
+problem *X(mkproblem_mdct)(INT n, int inverse, int ola, 
+			   R *I, R *O, const R *w);
+
+/* solve-mdct.c: */
+void X(mdct_solve)(const plan *ego_, const problem *p_);
+
 void X(redft00e_r2hc_register)(planner *p);
 void X(redft00e_r2hc_pad_register)(planner *p);
 void X(rodft00e_r2hc_register)(planner *p);
 void X(rodft00e_r2hc_pad_register)(planner *p);
 void X(reodft00e_splitradix_register)(planner *p);
 void X(reodft010e_r2hc_register)(planner *p);
+void X(reodft010e_radix2_register)(planner *p);
 void X(reodft11e_r2hc_register)(planner *p);
 void X(reodft11e_radix2_r2hc_register)(planner *p);
 void X(reodft11e_r2hc_odd_register)(planner *p);
+void X(mdct_register)(planner *p);
 
 /* configurations */
 void X(reodft_conf_standard)(planner *p);
@@ -95,18 +95,10 @@ static void apply_re01(const plan *ego_, R *I, R *O)
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, apb, amb, wa, wb;
-	       a = I[is * i];
-	       b = I[is * (n - i)];
-	       apb = a + b;
-	       amb = a - b;
-	       wa = W[2*i];
-	       wb = W[2*i + 1];
-	       buf[i] = wa * amb + wb * apb; 
-	       buf[n - i] = wa * apb - wb * amb; 
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, I, is, I + is * n, -is, buf, 1, buf + n, -1, W,
+		       1, K(1.0), K(1.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       buf[i] = K(2.0) * I[is * i] * W[2*i];
 	  }
 	  
@@ -116,17 +108,9 @@ static void apply_re01(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  O[0] = buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b;
-	       INT k;
-	       a = buf[i];
-	       b = buf[n - i];
-	       k = i + i;
-	       O[os * (k - 1)] = a - b;
-	       O[os * k] = a + b;
-	  }
-	  if (i == n - i) {
-	       O[os * (n - 1)] = buf[i];
+	  X(hc_unfold)(n, buf, O, os, 0, K(1.0));
+	  if (n % 2 == 0) {
+	       O[os * (n - 1)] = buf[n / 2];
 	  }
      }
 
@@ -149,18 +133,10 @@ static void apply_ro01(const plan *ego_, R *I, R *O)
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[is * (n - 1)];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, apb, amb, wa, wb;
-	       a = I[is * (n - 1 - i)];
-	       b = I[is * (i - 1)];
-	       apb = a + b;
-	       amb = a - b;
-	       wa = W[2*i];
-	       wb = W[2*i+1];
-	       buf[i] = wa * amb + wb * apb; 
-	       buf[n - i] = wa * apb - wb * amb; 
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, I + is * (n - 1), -is, I - is, is,
+		       buf, 1, buf + n, -1, W, 1, K(1.0), K(1.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       buf[i] = K(2.0) * I[is * (i - 1)] * W[2*i];
 	  }
 	  
@@ -170,17 +146,9 @@ static void apply_ro01(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  O[0] = buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b;
-	       INT k;
-	       a = buf[i];
-	       b = buf[n - i];
-	       k = i + i;
-	       O[os * (k - 1)] = b - a;
-	       O[os * k] = a + b;
-	  }
-	  if (i == n - i) {
-	       O[os * (n - 1)] = -buf[i];
+	  X(hc_unfold)(n, buf, O, os, 0, K(-1.0));
+	  if (n % 2 == 0) {
+	       O[os * (n - 1)] = -buf[n / 2];
 	  }
      }
 
@@ -201,16 +169,9 @@ static void apply_re10(const plan *ego_, R *I, R *O)
 
      for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
 	  buf[0] = I[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E u, v;
-	       INT k = i + i;
-	       u = I[is * (k - 1)];
-	       v = I[is * k];
-	       buf[n - i] = u;
-	       buf[i] = v;
-	  }
-	  if (i == n - i) {
-	       buf[i] = I[is * (n - 1)];
+	  X(hc_copy)(n, I, 2 * is, I - is, 2 * is, buf, 1, buf + n, -1);
+	  if (n % 2 == 0) {
+	       buf[n / 2] = I[is * (n - 1)];
 	  }
 	  
 	  {
@@ -219,16 +180,10 @@ static void apply_re10(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  O[0] = K(2.0) * buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, wa, wb;
-	       a = K(2.0) * buf[i];
-	       b = K(2.0) * buf[n - i];
-	       wa = W[2*i];
-	       wb = W[2*i + 1];
-	       O[os * i] = wa * a + wb * b;
-	       O[os * (n - i)] = wb * a - wa * b;
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, buf, 1, buf + n, -1, O, os, O + os * n, -os, W,
+		       0, K(2.0), K(-2.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       O[os * i] = K(2.0) * buf[i] * W[2*i];
 	  }
      }
@@ -270,16 +225,10 @@ static void apply_ro10(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  O[os * (n - 1)] = K(2.0) * buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, wa, wb;
-	       a = K(2.0) * buf[i];
-	       b = K(2.0) * buf[n - i];
-	       wa = W[2*i];
-	       wb = W[2*i + 1];
-	       O[os * (n - 1 - i)] = wa * a + wb * b;
-	       O[os * (i - 1)] = wb * a - wa * b;
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, buf, 1, buf + n, -1, O + os * (n - 1), -os,
+		       O - os, os, W, 0, K(2.0), K(-2.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       O[os * (i - 1)] = K(2.0) * buf[i] * W[2*i];
 	  }
      }
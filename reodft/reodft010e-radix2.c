@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* Do an R{E,O}DFT{01,10} problem of *even* size N recursively, by a
+   half-size R{E}DFT{01,10} problem and a half-size REDFT11 problem,
+   in the style of a radix-2 Cooley-Tukey step.  For REDFT10:
+
+      u[j] = x[j] + x[N-1-j],   v[j] = x[j] - x[N-1-j],   j < N/2,
+      y[2k] = REDFT10(u)[k],    y[2k+1] = REDFT11(v)[k],
+
+   and REDFT01 is the transpose of these steps.  The R2HC-based
+   solvers in reodft010e-r2hc.c need pre- and post-processing passes
+   with twiddle factors around the child; here a single butterfly pass
+   suffices, and the children read their input or write their output
+   directly with stride 2.  The recursion bottoms out in hard-coded
+   REDFT01/10 codelets (see rdft/scalar/r2r) or in reodft010e-r2hc.c.
+
+   RODFT10 is REDFT10 of the input with every other sign flipped,
+   followed by a reversal of the output, and RODFT01 is obtained from
+   REDFT01 by reversing the input and flipping the sign of every other
+   output; both are folded into the butterflies and the children's
+   strides. */
+
+#include "reodft/reodft.h"
+
+typedef struct {
+     solver super;
+} S;
+
+typedef struct {
+     plan_rdft super;
+     plan *cld, *cld11;
+     INT is, os;
+     INT n;
+     INT vl;
+     INT ivs, ovs;
+     INT cldofs, cld11ofs;	/* offsets of the children's data in I/O */
+     rdft_kind kind;
+} P;
+
+static void apply_10(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cld11 = (plan_rdft *) ego->cld11;
+     INT is = ego->is;
+     INT i, n = ego->n, n2 = n / 2;
+     INT iv, vl = ego->vl;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *buf;
+
+     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
+	  if (ego->kind == REDFT10) {
+	       for (i = 0; i < n2; ++i) {
+		    E a = I[is * i], b = I[is * (n - 1 - i)];
+		    buf[i] = a + b;
+		    buf[n2 + i] = a - b;
+	       }
+	  } else {
+	       for (i = 0; i < n2; ++i) {
+		    E a = I[is * i], b = I[is * (n - 1 - i)];
+		    if (i & 1) { a = -a; b = -b; }
+		    buf[i] = a - b;
+		    buf[n2 + i] = a + b;
+	       }
+	  }
+
+	  /* children: the even and the odd outputs */
+	  cld->apply((plan *) cld, buf, O + ego->cldofs);
+	  cld11->apply((plan *) cld11, buf + n2, O + ego->cld11ofs);
+     }
+
+     X(ifree)(buf);
+}
+
+static void apply_01(const plan *ego_, R *I, R *O)
+{
+     const P *ego = (const P *) ego_;
+     plan_rdft *cld = (plan_rdft *) ego->cld;
+     plan_rdft *cld11 = (plan_rdft *) ego->cld11;
+     INT os = ego->os;
+     INT i, n = ego->n, n2 = n / 2;
+     INT iv, vl = ego->vl;
+     INT ivs = ego->ivs, ovs = ego->ovs;
+     R *buf;
+
+     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     for (iv = 0; iv < vl; ++iv, I += ivs, O += ovs) {
+	  /* children: the even and the odd inputs */
+	  cld->apply((plan *) cld, I + ego->cldofs, buf);
+	  cld11->apply((plan *) cld11, I + ego->cld11ofs, buf + n2);
+
+	  if (ego->kind == REDFT01) {
+	       for (i = 0; i < n2; ++i) {
+		    E a = buf[i], b = buf[n2 + i];
+		    O[os * i] = a + b;
+		    O[os * (n - 1 - i)] = a - b;
+	       }
+	  } else {
+	       for (i = 0; i < n2; ++i) {
+		    E a = buf[i], b = buf[n2 + i];
+		    if (i & 1) {
+			 O[os * i] = -(a + b);
+			 O[os * (n - 1 - i)] = a - b;
+		    } else {
+			 O[os * i] = a + b;
+			 O[os * (n - 1 - i)] = b - a;
+		    }
+	       }
+	  }
+     }
+
+     X(ifree)(buf);
+}
+
+static void awake(plan *ego_, enum wakefulness wakefulness)
+{
+     P *ego = (P *) ego_;
+     X(plan_awake)(ego->cld, wakefulness);
+     X(plan_awake)(ego->cld11, wakefulness);
+}
+
+static void destroy(plan *ego_)
+{
+     P *ego = (P *) ego_;
+     X(plan_destroy_internal)(ego->cld11);
+     X(plan_destroy_internal)(ego->cld);
+}
+
+static void print(const plan *ego_, printer *p)
+{
+     const P *ego = (const P *) ego_;
+     p->print(p, "(%se-radix2-%D%v%(%p%)%(%p%))",
+	      X(rdft_kind_str)(ego->kind), ego->n, ego->vl, 
+	      ego->cld, ego->cld11);
+}
+
+static int applicable0(const solver *ego_, const problem *p_)
+{
+     const problem_rdft *p = (const problem_rdft *) p_;
+     UNUSED(ego_);
+
+     return (1
+	     && p->sz->rnk == 1
+	     && p->vecsz->rnk <= 1
+	     && p->sz->dims[0].n % 2 == 0
+	     && (p->kind[0] == REDFT01 || p->kind[0] == REDFT10
+		 || p->kind[0] == RODFT01 || p->kind[0] == RODFT10)
+	  );
+}
+
+static int applicable(const solver *ego, const problem *p, const planner *plnr)
+{
+     UNUSED(plnr);
+     return applicable0(ego, p);
+}
+
+static plan *mkplan(const solver *ego_, const problem *p_, planner *plnr)
+{
+     P *pln;
+     const problem_rdft *p;
+     plan *cld = 0, *cld11 = 0;
+     R *buf;
+     INT n, n2, is, os, cldofs, cld11ofs;
+     rdft_kind kind, cldkind;
+     opcnt ops;
+
+     static const plan_adt padt = {
+	  X(rdft_solve), awake, print, destroy
+     };
+
+     if (!applicable(ego_, p_, plnr))
+          return (plan *)0;
+
+     p = (const problem_rdft *) p_;
+
+     n = p->sz->dims[0].n;
+     n2 = n / 2;
+     is = p->sz->dims[0].is;
+     os = p->sz->dims[0].os;
+     kind = p->kind[0];
+     cldkind = (kind == REDFT10 || kind == RODFT10) ? REDFT10 : REDFT01;
+
+     buf = (R *) MALLOC(sizeof(R) * n, BUFFERS);
+
+     if (cldkind == REDFT10) {
+	  INT s;
+	  if (kind == REDFT10) {
+	       cldofs = 0; cld11ofs = os; s = 2 * os;
+	  } else {
+	       /* reversed output */
+	       cldofs = os * (n - 1); cld11ofs = os * (n - 2); s = -2 * os;
+	  }
+
+	  /* the buffer is ours, and can be destroyed */
+	  cld = X(mkplan_f_d)(plnr, 
+			      X(mkproblem_rdft_1_d)(
+				   X(mktensor_1d)(n2, 1, s),
+				   X(mktensor_0d)(),
+				   buf, p->O + cldofs, REDFT10),
+			      0, 0, NO_DESTROY_INPUT);
+	  if (!cld) goto nada;
+
+	  cld11 = X(mkplan_f_d)(plnr, 
+				X(mkproblem_rdft_1_d)(
+				     X(mktensor_1d)(n2, 1, s),
+				     X(mktensor_0d)(),
+				     buf + n2, p->O + cld11ofs, REDFT11),
+				0, 0, NO_DESTROY_INPUT);
+	  if (!cld11) goto nada;
+     } else {
+	  INT s;
+	  if (kind == REDFT01) {
+	       cldofs = 0; cld11ofs = is; s = 2 * is;
+	  } else {
+	       /* reversed input */
+	       cldofs = is * (n - 1); cld11ofs = is * (n - 2); s = -2 * is;
+	  }
+
+	  cld = X(mkplan_d)(plnr, 
+			    X(mkproblem_rdft_1_d)(
+				 X(mktensor_1d)(n2, s, 1),
+				 X(mktensor_0d)(),
+				 p->I + cldofs, buf, REDFT01));
+	  if (!cld) goto nada;
+
+	  cld11 = X(mkplan_d)(plnr, 
+			      X(mkproblem_rdft_1_d)(
+				   X(mktensor_1d)(n2, s, 1),
+				   X(mktensor_0d)(),
+				   p->I + cld11ofs, buf + n2, REDFT11));
+	  if (!cld11) goto nada;
+     }
+
+     X(ifree)(buf);
+
+     pln = MKPLAN_RDFT(P, &padt, cldkind == REDFT10 ? apply_10 : apply_01);
+     pln->n = n;
+     pln->is = is;
+     pln->os = os;
+     pln->cld = cld;
+     pln->cld11 = cld11;
+     pln->cldofs = cldofs;
+     pln->cld11ofs = cld11ofs;
+     pln->kind = kind;
+     
+     X(tensor_tornk1)(p->vecsz, &pln->vl, &pln->ivs, &pln->ovs);
+     
+     X(ops_zero)(&ops);
+     ops.add = n;
+     ops.other = 2 * n;
+     X(ops_add2)(&cld->ops, &ops);
+     X(ops_add2)(&cld11->ops, &ops);
+
+     X(ops_zero)(&pln->super.super.ops);
+     X(ops_madd2)(pln->vl, &ops, &pln->super.super.ops);
+
+     return &(pln->super.super);
+
+ nada:
+     X(ifree)(buf);
+     X(plan_destroy_internal)(cld11);
+     X(plan_destroy_internal)(cld);
+     return (plan *)0;
+}
+
+/* constructor */
+static solver *mksolver(void)
+{
+     static const solver_adt sadt = { PROBLEM_RDFT, mkplan, 0 };
+     S *slv = MKSOLVER(S, &sadt);
+     return &(slv->super);
+}
+
+void X(reodft010e_radix2_register)(planner *p)
+{
+     REGISTER_SOLVER(p, mksolver());
+}
@@ -74,18 +74,10 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  W = ego->td->W;
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, apb, amb, wa, wb;
-	       a = buf[i];
-	       b = buf[n - i];
-	       apb = a + b;
-	       amb = a - b;
-	       wa = W[2*i];
-	       wb = W[2*i + 1];
-	       buf[i] = wa * amb + wb * apb; 
-	       buf[n - i] = wa * apb - wb * amb; 
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, buf, 1, buf + n, -1, buf, 1, buf + n, -1, W,
+		       1, K(1.0), K(1.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       buf[i] = K(2.0) * buf[i] * W[2*i];
 	  }
 	  
@@ -96,17 +88,9 @@ static void apply_re11(const plan *ego_, R *I, R *O)
 	  
 	  W = ego->td2->W;
 	  O[0] = W[0] * buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b;
-	       INT k;
-	       a = buf[i];
-	       b = buf[n - i];
-	       k = i + i;
-	       O[os * (k - 1)] = W[k - 1] * (a - b);
-	       O[os * k] = W[k] * (a + b);
-	  }
-	  if (i == n - i) {
-	       O[os * (n - 1)] = W[n - 1] * buf[i];
+	  X(hc_unfold)(n, buf, O, os, W, K(1.0));
+	  if (n % 2 == 0) {
+	       O[os * (n - 1)] = W[n - 1] * buf[n / 2];
 	  }
      }
 
@@ -139,18 +123,10 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
 	  }
 	  
 	  W = ego->td->W;
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b, apb, amb, wa, wb;
-	       a = buf[i];
-	       b = buf[n - i];
-	       apb = a + b;
-	       amb = a - b;
-	       wa = W[2*i];
-	       wb = W[2*i + 1];
-	       buf[i] = wa * amb + wb * apb; 
-	       buf[n - i] = wa * apb - wb * amb; 
-	  }
-	  if (i == n - i) {
+	  X(hc_rotate)(n, buf, 1, buf + n, -1, buf, 1, buf + n, -1, W,
+		       1, K(1.0), K(1.0));
+	  if (n % 2 == 0) {
+	       i = n / 2;
 	       buf[i] = K(2.0) * buf[i] * W[2*i];
 	  }
 	  
@@ -161,17 +137,9 @@ static void apply_ro11(const plan *ego_, R *I, R *O)
 	  
 	  W = ego->td2->W;
 	  O[0] = W[0] * buf[0];
-	  for (i = 1; i < n - i; ++i) {
-	       E a, b;
-	       INT k;
-	       a = buf[i];
-	       b = buf[n - i];
-	       k = i + i;
-	       O[os * (k - 1)] = W[k - 1] * (b - a);
-	       O[os * k] = W[k] * (a + b);
-	  }
-	  if (i == n - i) {
-	       O[os * (n - 1)] = -W[n - 1] * buf[i];
+	  X(hc_unfold)(n, buf, O, os, W, K(-1.0));
+	  if (n % 2 == 0) {
+	       O[os * (n - 1)] = -W[n - 1] * buf[n / 2];
 	  }
      }
 
@@ -61,6 +61,27 @@ int X(have_simd_avx512)(void)
      return res;
 }
 
+/* AVX512_BF16, for the BF16 stores of rdft/simd/avx512/storage-bf16.c */
+int X(have_simd_avx512_bf16)(void)
+{
+     static int init = 0, res;
+     int eax, ebx, ecx, edx;
+
+     if (!init) {
+          if (X(have_simd_avx512)()) {
+               /* have leaf 7, subleaf 1? */
+               cpuid_all(7,0,&eax,&ebx,&ecx,&edx);
+               if (eax >= 1) {
+                    cpuid_all(7,1,&eax,&ebx,&ecx,&edx);
+                    res = (eax & (1 << 5)) != 0;
+               }
+          }
+          init = 1;
+     }
+
+     return res;
+}
+
 #else /* 32-bit code */
 
 #error "Avx512 is 64 bits only"
@@ -155,6 +155,93 @@ static inline void STu(R *x, V v, INT ovs, const R *aligned_like)
 #define LD LDu
 #define ST STu
 
+/* LDt/STt: like LD/ST, but for the first N < VL complex numbers only,
+   for the tails of loops whose length is not a multiple of VL.  The
+   other lanes are zero on load and left alone on store; masked-out
+   lanes are never accessed, so they may lie past the end of the
+   array. */
+#define SIMD_MASKED_TAIL 1
+
+#if FFTW_SINGLE
+
+static inline V LDt(const R *x, INT ivs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  __m512i index = _mm512_set_epi32(7 * ivs + 1, 7 * ivs,
+                                   6 * ivs + 1, 6 * ivs,
+                                   5 * ivs + 1, 5 * ivs,
+                                   4 * ivs + 1, 4 * ivs,
+                                   3 * ivs + 1, 3 * ivs,
+                                   2 * ivs + 1, 2 * ivs,
+                                   1 * ivs + 1, 1 * ivs,
+                                   0 * ivs + 1, 0 * ivs);
+  __mmask16 m = (__mmask16)((1u << (2 * n)) - 1);
+
+  return _mm512_mask_i32gather_ps(VZERO, m, index, x, 4);
+}
+
+static inline void STt(R *x, V v, INT ovs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  __m512i index = _mm512_set_epi32(7 * ovs + 1, 7 * ovs,
+                                   6 * ovs + 1, 6 * ovs,
+                                   5 * ovs + 1, 5 * ovs,
+                                   4 * ovs + 1, 4 * ovs,
+                                   3 * ovs + 1, 3 * ovs,
+                                   2 * ovs + 1, 2 * ovs,
+                                   1 * ovs + 1, 1 * ovs,
+                                   0 * ovs + 1, 0 * ovs);
+  __mmask16 m = (__mmask16)((1u << (2 * n)) - 1);
+
+  _mm512_mask_i32scatter_ps(x, m, index, v, 4);
+}
+
+#else /* !FFTW_SINGLE */
+
+static inline V LDt(const R *x, INT ivs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  __m256i index = _mm256_set_epi32(3 * ivs + 1, 3 * ivs,
+                                   2 * ivs + 1, 2 * ivs,
+                                   1 * ivs + 1, 1 * ivs,
+                                   0 * ivs + 1, 0 * ivs);
+  __mmask8 m = (__mmask8)((1u << (2 * n)) - 1);
+
+  return _mm512_mask_i32gather_pd(VZERO, m, index, x, 8);
+}
+
+static inline void STt(R *x, V v, INT ovs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  __m256i index = _mm256_set_epi32(3 * ovs + 1, 3 * ovs,
+                                   2 * ovs + 1, 2 * ovs,
+                                   1 * ovs + 1, 1 * ovs,
+                                   0 * ovs + 1, 0 * ovs);
+  __mmask8 m = (__mmask8)((1u << (2 * n)) - 1);
+
+  _mm512_mask_i32scatter_pd(x, m, index, v, 8);
+}
+
+#endif /* FFTW_SINGLE */
+
+/* LDAt/STAt: the masked forms of LDA/STA */
+static inline V LDAt(const R *x, INT ivs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  (void)ivs; /* UNUSED */
+  return SUFF(_mm512_maskz_loadu)((DS(__mmask8, __mmask16))((1u << (2 * n)) - 1), x);
+}
+
+static inline void STAt(R *x, V v, INT ovs, const R *aligned_like, INT n)
+{
+  (void)aligned_like; /* UNUSED */
+  (void)ovs; /* UNUSED */
+  SUFF(_mm512_mask_storeu)(x, (DS(__mmask8, __mmask16))((1u << (2 * n)) - 1), v);
+}
+
+/* number of lanes of a codelet loop iteration with N transforms left */
+#define VTAIL(n) ((n) < VL ? (n) : VL)
+
 #ifdef FFTW_SINGLE
 #define STM2(x, v, ovs, a) ST(x, v, ovs, a)
 #define STN2(x, v0, v1, ovs) /* nop */
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* 512-bit variant of simd-generic256.h */
+
+#if defined(FFTW_LDOUBLE) || defined(FFTW_QUAD)
+#  error "Generic simd512 only works in single or double precision"
+#endif
+
+#define SIMD_SUFFIX  _generic_simd512  /* for renaming */
+
+#ifdef FFTW_SINGLE
+#  define DS(d,s) s /* single-precision option */
+#  define DVK(var, val) V var = {val,val,val,val,val,val,val,val,	\
+                                 val,val,val,val,val,val,val,val}
+#else
+#  define DS(d,s) d /* double-precision option */
+#  define DVK(var, val) V var = {val,val,val,val,val,val,val,val}
+#endif
+
+#define VL DS(4,8)         /* SIMD vector length, in term of complex numbers */
+#define SIMD_VSTRIDE_OKA(x) ((x) == 2)
+#define SIMD_STRIDE_OKPAIR SIMD_STRIDE_OK
+
+typedef DS(double,float) V __attribute__ ((vector_size(64)));
+
+/* Unlike simd-generic256.h, the lane-wise operations below are written
+   as loops over the 2*VL lanes, which the compiler unrolls; spelling
+   out 16 lanes by hand would not make the code any faster. */
+
+#define VADD(a,b) ((a)+(b))
+#define VSUB(a,b) ((a)-(b))
+#define VMUL(a,b) ((a)*(b))
+
+#define LDK(x) x
+
+static inline V LDA(const R *x, INT ivs, const R *aligned_like)
+{
+    (void)aligned_like; /* UNUSED */
+    (void)ivs; /* UNUSED */
+    return *(const V *)x;
+}
+
+static inline void STA(R *x, V v, INT ovs, const R *aligned_like)
+{
+    (void)aligned_like; /* UNUSED */
+    (void)ovs; /* UNUSED */
+    *(V *)x = v;
+}
+
+static inline V LD(const R *x, INT ivs, const R *aligned_like)
+{
+    V var;
+    int k;
+    (void)aligned_like; /* UNUSED */
+    for (k = 0; k < VL; ++k) {
+        var[2*k] = x[k*ivs];
+        var[2*k+1] = x[k*ivs+1];
+    }
+    return var;
+}
+
+/* ST has to be separate due to the storage hack requiring reverse order */
+
+static inline void ST(R *x, V v, INT ovs, const R *aligned_like)
+{
+    int k;
+    (void)aligned_like; /* UNUSED */
+    for (k = VL - 1; k >= 0; --k) {
+        *(x + k*ovs    ) = v[2*k];
+        *(x + k*ovs + 1) = v[2*k+1];
+    }
+}
+
+#define STM2(x, v, ovs, a) ST(x, v, ovs, a)
+#define STN2(x, v0, v1, ovs) /* nop */
+
+static inline void STM4(R *x, V v, INT ovs, const R *aligned_like)
+{
+    int k;
+    (void)aligned_like; /* UNUSED */
+    for (k = 0; k < 2*VL; ++k)
+        x[k*ovs] = v[k];
+}
+#define STN4(x, v0, v1, v2, v3, ovs)  /* no-op */
+
+static inline V VDUPL(V x)
+{
+    V var;
+    int k;
+    for (k = 0; k < VL; ++k)
+        var[2*k] = var[2*k+1] = x[2*k];
+    return var;
+}
+
+static inline V VDUPH(V x)
+{
+    V var;
+    int k;
+    for (k = 0; k < VL; ++k)
+        var[2*k] = var[2*k+1] = x[2*k+1];
+    return var;
+}
+
+static inline V FLIP_RI(V x)
+{
+    V var;
+    int k;
+    for (k = 0; k < VL; ++k) {
+        var[2*k] = x[2*k+1];
+        var[2*k+1] = x[2*k];
+    }
+    return var;
+}
+
+static inline V VCONJ(V x)
+{
+    V var;
+    int k;
+    for (k = 0; k < VL; ++k) {
+        var[2*k] = x[2*k];
+        var[2*k+1] = -x[2*k+1];
+    }
+    return var;
+}
+
+static inline V VBYI(V x)
+{
+     return FLIP_RI(VCONJ(x));
+}
+
+/* FMA support */
+#define VFMA(a, b, c) VADD(c, VMUL(a, b))
+#define VFNMS(a, b, c) VSUB(c, VMUL(a, b))
+#define VFMS(a, b, c) VSUB(VMUL(a, b), c)
+#define VFMAI(b, c) VADD(c, VBYI(b))
+#define VFNMSI(b, c) VSUB(c, VBYI(b))
+#define VFMACONJ(b,c)  VADD(VCONJ(b),c)
+#define VFMSCONJ(b,c)  VSUB(VCONJ(b),c)
+#define VFNMSCONJ(b,c) VSUB(c, VCONJ(b))
+
+static inline V VZMUL(V tx, V sr)
+{
+     V tr = VDUPL(tx);
+     V ti = VDUPH(tx);
+     tr = VMUL(sr, tr);
+     sr = VBYI(sr);
+     return VFMA(ti, sr, tr);
+}
+
+static inline V VZMULJ(V tx, V sr)
+{
+     V tr = VDUPL(tx);
+     V ti = VDUPH(tx);
+     tr = VMUL(sr, tr);
+     sr = VBYI(sr);
+     return VFNMS(ti, sr, tr);
+}
+
+static inline V VZMULI(V tx, V sr)
+{
+     V tr = VDUPL(tx);
+     V ti = VDUPH(tx);
+     ti = VMUL(ti, sr);
+     sr = VBYI(sr);
+     return VFMS(tr, sr, ti);
+}
+
+static inline V VZMULIJ(V tx, V sr)
+{
+     V tr = VDUPL(tx);
+     V ti = VDUPH(tx);
+     ti = VMUL(ti, sr);
+     sr = VBYI(sr);
+     return VFMA(tr, sr, ti);
+}
+
+/* twiddle storage #1: compact, slower */
+#define DEFVTW1(v, x) {TW_CEXP, v, x}
+#define VTW1(v,x) CONCAT2(REPEAT_, VL)(DEFVTW1, v, x)
+#define TWVL1 (VL)
+
+static inline V BYTW1(const R *t, V sr)
+{
+     return VZMUL(LDA(t, 2, t), sr);
+}
+
+static inline V BYTWJ1(const R *t, V sr)
+{
+     return VZMULJ(LDA(t, 2, t), sr);
+}
+
+/* twiddle storage #2: twice the space, faster (when in cache) */
+#define DEFVTW2_COS(v, x) {TW_COS, v, x}, {TW_COS, v, x}
+#define DEFVTW2_SIN(v, x) {TW_SIN, v, -x}, {TW_SIN, v, x}
+#define VTW2(v,x) CONCAT2(REPEAT_, VL)(DEFVTW2_COS, v, x),      \
+          CONCAT2(REPEAT_, VL)(DEFVTW2_SIN, v, x)
+#define TWVL2 (2 * VL)
+
+static inline V BYTW2(const R *t, V sr)
+{
+     const V *twp = (const V *)t;
+     V si = FLIP_RI(sr);
+     V tr = twp[0], ti = twp[1];
+     return VFMA(tr, sr, VMUL(ti, si));
+}
+
+static inline V BYTWJ2(const R *t, V sr)
+{
+     const V *twp = (const V *)t;
+     V si = FLIP_RI(sr);
+     V tr = twp[0], ti = twp[1];
+     return VFNMS(ti, si, VMUL(tr, sr));
+}
+
+/* twiddle storage #3 */
+#define VTW3 VTW1
+#define TWVL3 TWVL1
+
+/* twiddle storage for split arrays */
+#define DEFVTWS_COS(v, x) {TW_COS, v, x}
+#define DEFVTWS_SIN(v, x) {TW_SIN, v, x}
+#define VTWS(v,x) CONCAT2(REPEAT_, DS(8,16))(DEFVTWS_COS, v, x),        \
+          CONCAT2(REPEAT_, DS(8,16))(DEFVTWS_SIN, v, x)
+#define TWVLS (2 * VL)
+
+#define VLEAVE() /* nothing */
+
+#include "simd-common.h"
@@ -0,0 +1,1141 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/* checks of the API functions that the bench program does not
+   exercise.  Each transform is compared against a direct O(n^2)
+   evaluation in long double, and the relative l-infinity error must
+   not exceed TOL, the tolerance the transform was planned for, or the
+   rounding of its 16-bit output.  Run with -v to print the errors. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "config.h"
+#include "api/fftw3.h"
+
+#if defined(FFTW_SINGLE)
+typedef float R;
+#  define X(name) fftwf_ ## name
+#  define TOL 1e-4
+#  define EPS 1e-5
+#elif defined(FFTW_LDOUBLE)
+typedef long double R;
+#  define X(name) fftwl_ ## name
+#  define TOL 1e-12
+#  define EPS 1e-9
+#elif defined(FFTW_QUAD)
+typedef __float128 R;
+#  define X(name) fftwq_ ## name
+#  define TOL 1e-12
+#  define EPS 1e-9
+#else
+typedef double R;
+#  define X(name) fftw_ ## name
+#  define TOL 1e-10
+#  define EPS 1e-9
+#endif
+
+typedef X(complex) C;
+typedef long double trigreal;
+
+#define K2PI ((trigreal)6.2831853071795864769252867665590057683943388L)
+
+static int verbose = 0, failures = 0;
+
+static void check(const char *what, double err, double tol)
+{
+     int ok = (err <= tol);
+     if (!ok) ++failures;
+     if (verbose || !ok)
+	  printf("%-40s rel l-inf error %.3g%s\n", what, err,
+		 ok ? "" : "  FAILED");
+}
+
+static void check_true(const char *what, int ok)
+{
+     if (!ok) ++failures;
+     if (verbose || !ok)
+	  printf("%-40s %s\n", what, ok ? "ok" : "FAILED");
+}
+
+static R rnd(void)
+{
+     return (R)(rand() / ((double)RAND_MAX + 1.0) - 0.5);
+}
+
+/* relative l-infinity error of the N complex numbers Y, with stride
+   YS, against REF */
+static double cerr(const trigreal *ref, const R *y, int n, int ys)
+{
+     trigreal e = 0, m = 0;
+     int i;
+     for (i = 0; i < n; ++i) {
+	  trigreal dr = ref[2 * i] - (trigreal) y[2 * i * ys];
+	  trigreal di = ref[2 * i + 1] - (trigreal) y[2 * i * ys + 1];
+	  trigreal a = fabsl(ref[2 * i]) + fabsl(ref[2 * i + 1]);
+	  if (fabsl(dr) + fabsl(di) > e) e = fabsl(dr) + fabsl(di);
+	  if (a > m) m = a;
+     }
+     return (double)(m > 0 ? e / m : e);
+}
+
+/* direct DFT of the N complex numbers X into Y, both interleaved */
+static void dft(int n, const trigreal *x, trigreal *y, int sign)
+{
+     int j, k;
+     for (k = 0; k < n; ++k) {
+	  trigreal yr = 0, yi = 0;
+	  for (j = 0; j < n; ++j) {
+	       trigreal t = sign * K2PI * (trigreal)(((long)j * k) % n) / n;
+	       trigreal c = cosl(t), s = sinl(t);
+	       yr += x[2 * j] * c - x[2 * j + 1] * s;
+	       yi += x[2 * j] * s + x[2 * j + 1] * c;
+	  }
+	  y[2 * k] = yr; y[2 * k + 1] = yi;
+     }
+}
+
+/* direct multidimensional DFT of the row-major array X of N0 x N1 */
+static void dft2(int n0, int n1, const trigreal *x, trigreal *y, int sign)
+{
+     trigreal *t = (trigreal *) malloc(sizeof(trigreal) * 2 * n0 * n1);
+     trigreal *a = (trigreal *) calloc((size_t) (2 * n0), sizeof(trigreal));
+     trigreal *b = (trigreal *) malloc(sizeof(trigreal) * 2 * n0);
+     int i, j;
+
+     for (i = 0; i < n0; ++i)
+	  dft(n1, x + 2 * i * n1, t + 2 * i * n1, sign);
+     for (j = 0; j < n1; ++j) {
+	  for (i = 0; i < n0; ++i) {
+	       a[2 * i] = t[2 * (i * n1 + j)];
+	       a[2 * i + 1] = t[2 * (i * n1 + j) + 1];
+	  }
+	  dft(n0, a, b, sign);
+	  for (i = 0; i < n0; ++i) {
+	       y[2 * (i * n1 + j)] = b[2 * i];
+	       y[2 * (i * n1 + j) + 1] = b[2 * i + 1];
+	  }
+     }
+     free(b); free(a); free(t);
+}
+
+/*************************************************************/
+/* out-of-core DFTs */
+
+/* a temporary file holding LEAD bytes of garbage followed by the N
+   complex numbers X, or its first half if SHORT */
+static FILE *mkfile(long lead, const C *x, int n, int truncated)
+{
+     FILE *f = tmpfile();
+     long i;
+     if (!f) return 0;
+     for (i = 0; i < lead; ++i) fputc(0x5a, f);
+     fwrite(x, sizeof(C), (size_t)(truncated ? n / 2 : n), f);
+     fflush(f);
+     return f;
+}
+
+/* the number of outputs compared with the direct DFT, for transforms
+   too large for an O(n^2) reference */
+#define OOC_SAMPLES 16
+
+/* the N roots of unity exp(SIGN 2 pi i j / N), interleaved */
+static trigreal *roots(int n, int sign)
+{
+     trigreal *w = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     int j;
+     for (j = 0; j < n; ++j) {
+	  trigreal t = sign * K2PI * (trigreal) j / n;
+	  w[2 * j] = cosl(t); w[2 * j + 1] = sinl(t);
+     }
+     return w;
+}
+
+/* output K of the row-major rank-RANK (1 or 2) transform of X, by
+   direct summation with the roots W0 and W1 of the two dimensions */
+static void dft_at(int rank, const ptrdiff_t *n, const C *x, int k, 
+		   const trigreal *w0, const trigreal *w1, trigreal *y)
+{
+     int n0 = rank == 1 ? 1 : (int) n[0], n1 = (int) n[rank - 1];
+     int k0 = k / n1, k1 = k % n1, j0, j1;
+     trigreal yr = 0, yi = 0;
+
+     for (j0 = 0; j0 < n0; ++j0) {
+	  trigreal sr = 0, si = 0, c, s;
+	  for (j1 = 0; j1 < n1; ++j1) {
+	       int e = (int) (((long) j1 * k1) % n1);
+	       c = w1[2 * e]; s = w1[2 * e + 1];
+	       sr += x[j0 * n1 + j1][0] * c - x[j0 * n1 + j1][1] * s;
+	       si += x[j0 * n1 + j1][0] * s + x[j0 * n1 + j1][1] * c;
+	  }
+	  c = w0[2 * ((j0 * k0) % n0)]; s = w0[2 * ((j0 * k0) % n0) + 1];
+	  yr += sr * c - si * s;
+	  yi += sr * s + si * c;
+     }
+     y[0] = yr; y[1] = yi;
+}
+
+/* an out-of-core transform of size N, compared with the direct DFT,
+   of all outputs if there are few, or of OOC_SAMPLES of them */
+static void ooc1(int rank, const ptrdiff_t *n, int sign, int same_file,
+		 unsigned flags)
+{
+     char what[80];
+     int i, N = 1, nref;
+     C *x, *y, *ys;
+     trigreal *xl, *yl;
+     FILE *fi, *fo;
+     long iofs = 24, oofs = 40;
+     X(plan) p;
+
+     for (i = 0; i < rank; ++i) N *= (int) n[i];
+     sprintf(what, "dft_ooc rank %d n=%d sign %d%s%s", rank, N, sign,
+	     same_file ? " one file" : "",
+	     (flags & FFTW_ESTIMATE) ? "" : " measure");
+
+     nref = N <= 4096 ? N : OOC_SAMPLES;
+     x = (C *) malloc(sizeof(C) * N); y = (C *) malloc(sizeof(C) * N);
+     ys = (C *) malloc(sizeof(C) * nref);
+     xl = (trigreal *) malloc(sizeof(trigreal) * 2 * nref);
+     yl = (trigreal *) malloc(sizeof(trigreal) * 2 * nref);
+     for (i = 0; i < N; ++i) {
+	  x[i][0] = rnd();
+	  x[i][1] = rnd();
+     }
+     if (nref < N) {
+	  /* the first and last outputs, and random ones in between */
+	  trigreal *w0 = roots(rank == 1 ? 1 : (int) n[0], sign);
+	  trigreal *w1 = roots((int) n[rank - 1], sign);
+	  for (i = 0; i < nref; ++i) {
+	       int k = i == 0 ? 0 : (i == 1 ? N - 1 : rand() % N);
+	       dft_at(rank, n, x, k, w0, w1, yl + 2 * i);
+	       xl[i] = k;
+	  }
+	  free(w1); free(w0);
+     } else {
+	  for (i = 0; i < N; ++i) {
+	       xl[2 * i] = x[i][0];
+	       xl[2 * i + 1] = x[i][1];
+	  }
+	  if (rank == 1)
+	       dft(N, xl, yl, sign);
+	  else
+	       dft2((int) n[0], N / (int) n[0], xl, yl, sign);
+     }
+
+     fi = mkfile(iofs, x, N, 0);
+     if (same_file) {
+	  fo = fi;
+	  oofs = iofs + (long) sizeof(C) * N + 8;
+     } else
+	  fo = mkfile(0, 0, 0, 0);
+     if (!fi || !fo) {
+	  printf("%-40s cannot create temporary files, skipped\n", what);
+	  goto done;
+     }
+
+     p = X(plan_dft_ooc)(rank, n, fileno(fi), iofs, fileno(fo), oofs,
+			 sign, flags | FFTW_DESTROY_INPUT);
+     if (!p) {
+	  /* no pread()/pwrite() on this system */
+	  if (verbose) printf("%-40s not supported\n", what);
+	  goto done;
+     }
+
+     if (X(execute_dft_ooc)(p, fileno(fi), iofs, fileno(fo), oofs) != 1
+	 || fseek(fo, oofs, SEEK_SET)
+	 || fread(y, sizeof(C), (size_t) N, fo) != (size_t) N)
+	  check_true(what, 0);
+     else {
+	  for (i = 0; i < nref; ++i) {
+	       int k = nref < N ? (int) xl[i] : i;
+	       ys[i][0] = y[k][0]; ys[i][1] = y[k][1];
+	  }
+	  check(what, cerr(yl, (R *) ys, nref, 1), TOL);
+     }
+
+     /* a truncated input must be reported, not abort */
+     if (!same_file) {
+	  FILE *fs = mkfile(iofs, x, N, 1);
+	  sprintf(what, "dft_ooc rank %d n=%d short input", rank, N);
+	  if (fs) {
+	       check_true(what, X(execute_dft_ooc)(p, fileno(fs), iofs, 
+						    fileno(fo), oofs) == 0);
+	       fclose(fs);
+	  }
+     }
+
+     X(destroy_plan)(p);
+ done:
+     if (fo && fo != fi) fclose(fo);
+     if (fi) fclose(fi);
+     free(yl); free(xl); free(ys); free(y); free(x);
+}
+
+/* planning with FFTW_MEASURE reads the input; if it is too short,
+   the planner falls back to estimating, and executing must fail */
+static void ooc_short_measure(void)
+{
+     static const ptrdiff_t n[] = { 12, 35 };
+     C *x = (C *) calloc(12 * 35, sizeof(C));
+     FILE *fs = mkfile(0, x, 12 * 35, 1), *fo = mkfile(0, 0, 0, 0);
+     X(plan) p;
+
+     if (fs && fo) {
+	  p = X(plan_dft_ooc)(2, n, fileno(fs), 0, fileno(fo), 0,
+			      FFTW_FORWARD, FFTW_MEASURE);
+	  check_true("dft_ooc measure, short input",
+		     !p || X(execute_dft_ooc)(p, fileno(fs), 0, 
+					      fileno(fo), 0) == 0);
+	  if (p) X(destroy_plan)(p);
+     }
+     if (fo) fclose(fo);
+     if (fs) fclose(fs);
+     free(x);
+}
+
+static void check_ooc(void)
+{
+     static const ptrdiff_t n1[] = { 1155 }, n2[] = { 12, 35 };
+     /* larger than the in-core budget of FFTW_CONSERVE_MEMORY, 2^20
+	complex numbers, in blocks that do not divide the sizes, so
+	that both passes run their remainder plans */
+     static const ptrdiff_t n1big[] = { 1100000 }, n2big[] = { 1100, 1000 };
+
+     ooc1(1, n1, FFTW_FORWARD, 0, FFTW_ESTIMATE);
+     ooc1(1, n1, FFTW_BACKWARD, 0, FFTW_ESTIMATE);
+     ooc1(2, n2, FFTW_FORWARD, 0, FFTW_ESTIMATE);
+     ooc1(2, n2, FFTW_BACKWARD, 1, FFTW_ESTIMATE);
+     ooc1(1, n1, FFTW_FORWARD, 0, FFTW_MEASURE);
+     ooc1(2, n2, FFTW_BACKWARD, 0, FFTW_MEASURE);
+     ooc1(1, n1big, FFTW_FORWARD, 0, FFTW_ESTIMATE | FFTW_CONSERVE_MEMORY);
+     ooc1(2, n2big, FFTW_BACKWARD, 0, FFTW_ESTIMATE | FFTW_CONSERVE_MEMORY);
+     ooc_short_measure();
+}
+
+/*************************************************************/
+/* non-uniform DFTs */
+
+/* direct sum between the M points X and the modes -N[i]/2 <= k[i] <
+   N[i]/2 of a rank-RANK transform, with N padded on the left to rank 3 */
+static void nudft(int type, int rank, const int *n, int m, const R *x,
+		  const C *c, const C *f, trigreal *y, int sign)
+{
+     int j, k0, k1, k2, i0 = 3 - rank, nm = n[0] * n[1] * n[2];
+
+     for (j = 0; j < 2 * (type == 1 ? nm : m); ++j) y[j] = 0;
+     for (j = 0; j < m; ++j) {
+	  int idx = 0;
+	  for (k0 = 0; k0 < n[0]; ++k0)
+	       for (k1 = 0; k1 < n[1]; ++k1)
+		    for (k2 = 0; k2 < n[2]; ++k2, ++idx) {
+			 int k[3];
+			 trigreal t = 0, cs, sn, ar, ai;
+			 int i;
+			 k[0] = k0 - n[0] / 2; k[1] = k1 - n[1] / 2;
+			 k[2] = k2 - n[2] / 2;
+			 for (i = i0; i < 3; ++i)
+			      t += k[i] * (trigreal) x[j * rank + i - i0];
+			 cs = cosl(sign * t); sn = sinl(sign * t);
+			 if (type == 1) {
+			      ar = c[j][0]; ai = c[j][1];
+			      y[2 * idx] += ar * cs - ai * sn;
+			      y[2 * idx + 1] += ar * sn + ai * cs;
+			 } else {
+			      ar = f[idx][0]; ai = f[idx][1];
+			      y[2 * j] += ar * cs - ai * sn;
+			      y[2 * j + 1] += ar * sn + ai * cs;
+			 }
+		    }
+     }
+}
+
+static void nufft1(int type, int rank, const int *n, int m, int sign)
+{
+     char what[64];
+     int i, n3[3] = { 1, 1, 1 }, nm = 1, ny;
+     R *x = (R *) malloc(sizeof(R) * m * rank);
+     R *x0 = (R *) malloc(sizeof(R) * m * rank);
+     C *c, *f;
+     trigreal *y;
+     X(plan) p;
+
+     for (i = 0; i < rank; ++i) {
+	  n3[3 - rank + i] = n[i];
+	  nm *= n[i];
+     }
+     ny = (type == 1) ? nm : m;
+     c = (C *) malloc(sizeof(C) * m); f = (C *) malloc(sizeof(C) * nm);
+     y = (trigreal *) malloc(sizeof(trigreal) * 2 * ny);
+     sprintf(what, "nufft%d rank %d n=%d m=%d sign %d", 
+	     type, rank, nm, m, sign);
+
+     /* coordinates outside [-pi, pi) must be folded back */
+     for (i = 0; i < m * rank; ++i)
+	  x0[i] = x[i] = (R) (4.0 * K2PI * rnd());
+
+     p = X(plan_nufft)(type, rank, n, m, x, c, f, sign, EPS, FFTW_MEASURE);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+     check_true("nufft planning leaves coordinates alone",
+		!memcmp(x, x0, sizeof(R) * m * rank));
+
+     for (i = 0; i < m; ++i) { c[i][0] = rnd(); c[i][1] = rnd(); }
+     for (i = 0; i < nm; ++i) { f[i][0] = rnd(); f[i][1] = rnd(); }
+     nudft(type, rank, n3, m, x, c, f, y, sign);
+     X(execute)(p);
+     check(what, cerr(y, type == 1 ? (R *) f : (R *) c, ny, 1), 10 * EPS);
+
+     X(destroy_plan)(p);
+ done:
+     free(y); free(f); free(c); free(x0); free(x);
+}
+
+static void check_nufft(void)
+{
+     static const int n1[] = { 45 }, n2[] = { 12, 10 }, n3[] = { 6, 5, 8 };
+     R x[20];
+     C c[10], f[120];
+     X(plan) p;
+     int i;
+
+     /* the planner measures with whatever the coordinates hold */
+     for (i = 0; i < 20; ++i)
+	  x[i] = (R) ((i % 2) ? HUGE_VAL : -HUGE_VAL) * (R) (i % 3);
+     p = X(plan_nufft)(1, 2, n2, 10, x, c, f, FFTW_FORWARD, EPS, 
+		       FFTW_MEASURE);
+     check_true("nufft planning, non-finite coordinates", p != 0);
+     if (p) X(destroy_plan)(p);
+
+     nufft1(1, 1, n1, 100, FFTW_FORWARD);
+     nufft1(2, 1, n1, 100, FFTW_BACKWARD);
+     nufft1(1, 2, n2, 70, FFTW_BACKWARD);
+     nufft1(2, 2, n2, 70, FFTW_FORWARD);
+     nufft1(1, 3, n3, 50, FFTW_FORWARD);
+     nufft1(2, 3, n3, 50, FFTW_BACKWARD);
+}
+
+/*************************************************************/
+/* chirp-z transforms */
+
+/* fractional part of Q A, for 0 <= Q < 2^31.  A is split into two
+   halves of at most 27 bits, whose products with Q are exact in a
+   64-bit long double (and approximate where long double is double) */
+static trigreal fracq(long q, double a)
+{
+     double t = 134217729.0 * a, hi = t - (t - a), lo = a - hi;
+     trigreal ph = (trigreal) q * hi, pl = (trigreal) q * lo;
+     trigreal f = (ph - floorl(ph)) + (pl - floorl(pl));
+     return f - floorl(f);
+}
+
+static void czt1(int n, int m, double f0, double df, int sign)
+{
+     char what[64];
+     C *x = (C *) malloc(sizeof(C) * n), *y = (C *) malloc(sizeof(C) * m);
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * 2 * m);
+     X(plan) p;
+     int j, k;
+
+     sprintf(what, "czt n=%d m=%d df=%g sign %d", n, m, df, sign);
+     p = X(plan_czt_1d)(n, m, x, y, f0, df, sign, FFTW_ESTIMATE);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (j = 0; j < n; ++j) { x[j][0] = rnd(); x[j][1] = rnd(); }
+     for (k = 0; k < m; ++k) {
+	  trigreal yr = 0, yi = 0;
+	  for (j = 0; j < n; ++j) {
+	       trigreal t = K2PI * (fracq(j, f0) + fracq((long) j * k, df));
+	       trigreal c = cosl(t), s = sign * sinl(t);
+	       yr += x[j][0] * c - x[j][1] * s;
+	       yi += x[j][0] * s + x[j][1] * c;
+	  }
+	  yl[2 * k] = yr; yl[2 * k + 1] = yi;
+     }
+
+     X(execute)(p);
+     check(what, cerr(yl, (R *) y, m, 1), TOL);
+     X(destroy_plan)(p);
+ done:
+     free(yl); free(y); free(x);
+}
+
+static void check_czt(void)
+{
+     czt1(37, 50, 0.125, 0.01, FFTW_FORWARD);
+     czt1(64, 64, 0.0, 1.0 / 64, FFTW_BACKWARD);
+     /* large phases, which must be reduced exactly */
+     czt1(20000, 64, 0.1, 0.3333, FFTW_FORWARD);
+     czt1(100000, 16, 0.75, 1.0 / 3.0, FFTW_BACKWARD);
+}
+
+/*************************************************************/
+/* short-time Fourier transforms */
+
+/* NFRAMES frames of N samples, HOP apart, of a ring of RING samples,
+   with the first frame at POS, against the direct DFT of each
+   frame */
+static void stft1(int n, int hop, int nframes, int ring, int pos,
+		  int windowed)
+{
+     char what[80];
+     int f, j, nc = n / 2 + 1;
+     R *w = 0, *in = (R *) malloc(sizeof(R) * ring);
+     C *out = (C *) malloc(sizeof(C) * nc * nframes);
+     trigreal *xl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     double e = 0;
+     X(plan) p;
+
+     sprintf(what, "stft n=%d hop=%d frames=%d ring=%d pos=%d%s",
+	     n, hop, nframes, ring, pos, windowed ? " windowed" : "");
+     if (windowed) {
+	  w = (R *) malloc(sizeof(R) * n);
+	  for (j = 0; j < n; ++j) w[j] = rnd();
+     }
+     p = X(plan_stft)(n, hop, nframes, ring, in, w, out, FFTW_ESTIMATE);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (j = 0; j < ring; ++j) in[j] = rnd();
+     X(execute_stft)(p, in, pos, out);
+
+     for (f = 0; f < nframes; ++f) {
+	  for (j = 0; j < n; ++j) {
+	       int t = ((pos + f * hop + j) % ring + ring) % ring;
+	       xl[2 * j] = (trigreal) in[t] * (w ? w[j] : 1);
+	       xl[2 * j + 1] = 0;
+	  }
+	  dft(n, xl, yl, FFTW_FORWARD);
+	  e = fmax(e, cerr(yl, (R *) (out + f * nc), nc, 1));
+     }
+     check(what, e, TOL);
+     X(destroy_plan)(p);
+ done:
+     free(yl); free(xl); free(out); free(in); free(w);
+}
+
+static void check_stft(void)
+{
+     /* windowed, gathered into the buffer */
+     stft1(64, 16, 10, 512, 0, 1);
+     /* windowed, wrapping around the end of the ring */
+     stft1(64, 16, 10, 512, 500, 1);
+     stft1(30, 7, 13, 60, -11, 1);
+     /* without a window, in the ring, at an unaligned position, and
+	with a remainder batch */
+     stft1(32, 8, 21, 1024, 3, 0);
+     stft1(16, 4, 67, 1024, 5, 0);
+     /* without a window, with batches that wrap */
+     stft1(32, 8, 21, 200, 150, 0);
+     stft1(17, 17, 3, 51, 34, 0);
+}
+
+/*************************************************************/
+/* streaming FIR filters */
+
+/* relative l-infinity error of the N reals Y against REF */
+static double rerr(const trigreal *ref, const R *y, int n)
+{
+     trigreal e = 0, m = 0;
+     int i;
+     for (i = 0; i < n; ++i) {
+	  trigreal d = fabsl(ref[i] - (trigreal) y[i]);
+	  if (d > e) e = d;
+	  if (fabsl(ref[i]) > m) m = fabsl(ref[i]);
+     }
+     return (double)(m > 0 ? e / m : e);
+}
+
+/* NBLOCKS executions of a filter with NTAPS taps, in place if
+   INPLACE, against the direct convolution of the whole stream */
+static void fir1(int ntaps, int block, int nblocks, int inplace, 
+		 unsigned flags)
+{
+     char what[64], what2[80];
+     int i, k, t, len = block * nblocks;
+     R *h = (R *) malloc(sizeof(R) * ntaps);
+     R *x = (R *) malloc(sizeof(R) * len), *y = (R *) malloc(sizeof(R) * len);
+     R *y2 = (R *) malloc(sizeof(R) * len);
+     R *in = (R *) malloc(sizeof(R) * block), *out;
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * len);
+     X(plan) p;
+
+     sprintf(what, "fir ntaps=%d block=%d%s%s", ntaps, block,
+	     inplace ? " in place" : "", 
+	     (flags & FFTW_ESTIMATE) ? "" : " measure");
+     out = inplace ? in : (R *) malloc(sizeof(R) * block);
+     for (i = 0; i < ntaps; ++i) h[i] = rnd();
+     p = X(plan_fir)(ntaps, h, block, in, out, flags);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (t = 0; t < len; ++t) x[t] = rnd();
+     for (t = 0; t < len; ++t) {
+	  trigreal s = 0;
+	  for (k = 0; k < ntaps && k <= t; ++k)
+	       s += (trigreal) h[k] * x[t - k];
+	  yl[t] = s;
+     }
+
+     for (i = 0; i < nblocks; ++i) {
+	  memcpy(in, x + i * block, sizeof(R) * block);
+	  X(execute)(p);
+	  memcpy(y + i * block, out, sizeof(R) * block);
+     }
+     check(what, rerr(yl, y, len), TOL);
+
+     /* the same stream again, from silence */
+     X(reset_stream_state)(p, 0);
+     for (i = 0; i < nblocks; ++i) {
+	  memcpy(in, x + i * block, sizeof(R) * block);
+	  X(execute_fir)(p, 0, in, out);
+	  memcpy(y + i * block, out, sizeof(R) * block);
+     }
+     sprintf(what2, "%s, reset", what);
+     check(what2, rerr(yl, y, len), TOL);
+
+     /* two streams, interleaved, on states of their own */
+     {
+	  R *s1 = X(alloc_stream_state)(p), *s2 = X(alloc_stream_state)(p);
+	  for (i = 0; i < nblocks; ++i) {
+	       X(execute_fir)(p, s2, x + i * block, y2 + i * block);
+	       memcpy(in, x + i * block, sizeof(R) * block);
+	       X(execute_fir)(p, s1, in, out);
+	       memcpy(y + i * block, out, sizeof(R) * block);
+	  }
+	  X(free)(s2); X(free)(s1);
+     }
+     sprintf(what2, "%s, two states", what);
+     check(what2, rerr(yl, y, len) + rerr(yl, y2, len), TOL);
+     X(destroy_plan)(p);
+ done:
+     if (out != in) free(out);
+     free(yl); free(in); free(y2); free(y); free(x); free(h);
+}
+
+static void check_fir(void)
+{
+     fir1(7, 3, 10, 0, FFTW_ESTIMATE);
+     fir1(100, 64, 8, 0, FFTW_ESTIMATE);
+     fir1(100, 64, 8, 1, FFTW_MEASURE);
+     fir1(1000, 256, 12, 1, FFTW_ESTIMATE);
+     fir1(300, 1000, 3, 0, FFTW_MEASURE);
+}
+
+/*************************************************************/
+/* MDCTs */
+
+/* cos(pi/N (j + 1/2 + N/2) (k + 1/2)), reduced exactly: the argument
+   is 2 pi (2j + 1 + N)(2k + 1) / 8N */
+static trigreal mdct_cos(int n, int j, int k)
+{
+     long q = ((long) (2 * j + 1 + n) * (2 * k + 1)) % (8L * n);
+     return cosl(K2PI * (trigreal) q / (trigreal) (8L * n));
+}
+
+/* MDCT of size N, or IMDCT if INV, with a random window if WINDOWED.
+   The overlap-added IMDCT is executed on three frames. */
+static void mdct1(int n, int inv, int ola, int windowed)
+{
+     char what[64];
+     int j, k, f, nframes = ola ? 3 : 1;
+     int nin = inv ? n : 2 * n, nout = inv ? (ola ? n : 2 * n) : n;
+     R *w = 0, *in = (R *) malloc(sizeof(R) * nin);
+     R *out = (R *) malloc(sizeof(R) * nout);
+     R *x = (R *) malloc(sizeof(R) * nin * nframes);
+     R *y = (R *) malloc(sizeof(R) * nout * nframes);
+     trigreal *yl = (trigreal *) calloc((size_t) ((nframes + 1) * n), 
+					sizeof(trigreal));
+     X(plan) p;
+
+     sprintf(what, "%s n=%d%s%s", inv ? "imdct" : "mdct", n,
+	     ola ? " overlap-add" : "", windowed ? " windowed" : "");
+     if (windowed) {
+	  w = (R *) malloc(sizeof(R) * 2 * n);
+	  for (j = 0; j < 2 * n; ++j) w[j] = rnd();
+     }
+     p = inv ? X(plan_imdct)(n, in, out, w, ola, FFTW_ESTIMATE)
+	  : X(plan_mdct)(n, in, out, w, FFTW_ESTIMATE);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     /* the 2N outputs of frame F of the IMDCT are added to the stream
+	at F N, and the overlap-added plan returns the stream N numbers
+	at a time */
+     for (j = 0; j < nin * nframes; ++j) x[j] = rnd();
+     for (f = 0; f < nframes; ++f) {
+	  const R *xf = x + f * nin;
+	  for (j = 0; j < (inv ? 2 * n : n); ++j) {
+	       trigreal s = 0;
+	       for (k = 0; k < nin; ++k)
+		    s += inv ? xf[k] * mdct_cos(n, j, k)
+			 : xf[k] * (w ? w[k] : 1) * mdct_cos(n, k, j);
+	       yl[f * n + j] += (inv && w) ? s * w[j] : s;
+	  }
+     }
+
+     for (f = 0; f < nframes; ++f) {
+	  memcpy(in, x + f * nin, sizeof(R) * nin);
+	  X(execute)(p);
+	  memcpy(y + f * nout, out, sizeof(R) * nout);
+     }
+     check(what, rerr(yl, y, nout * nframes), TOL);
+
+     if (ola) {
+	  /* the same stream, with a tail of the caller's */
+	  R *tail = (R *) calloc((size_t) n, sizeof(R));
+	  for (f = 0; f < nframes; ++f) {
+	       memcpy(in, x + f * nin, sizeof(R) * nin);
+	       X(execute_mdct)(p, tail, in, out);
+	       memcpy(y + f * nout, out, sizeof(R) * nout);
+	  }
+	  free(tail);
+	  strcat(what, ", caller's tail");
+	  check(what, rerr(yl, y, nout * nframes), TOL);
+     }
+     X(destroy_plan)(p);
+ done:
+     free(w); free(yl); free(y); free(x); free(out); free(in);
+}
+
+static void check_mdct(void)
+{
+     mdct1(2, 0, 0, 0);
+     mdct1(64, 0, 0, 1);
+     mdct1(90, 0, 0, 0);
+     mdct1(64, 1, 0, 0);
+     mdct1(90, 1, 0, 1);
+     mdct1(128, 1, 1, 1);
+     mdct1(30, 1, 1, 0);
+}
+
+/*************************************************************/
+/* plans with alignment variants */
+
+/* a DFT (KIND 0), R2C (1) or C2R (2) of size N, planned with
+   FFTW_ALIGNMENT_VARIANTS on aligned arrays, or on arrays misaligned
+   by one real number if SKEWED, and executed with the new-array
+   functions on aligned and misaligned arrays */
+static void variants1(int kind, int n, int skewed, unsigned flags)
+{
+     static const char *const nam[] = { "dft", "r2c", "c2r" };
+     static const int ioff[] = { 0, 1, 0 }, ooff[] = { 0, 1, 1 };
+     char what[80];
+     int i, k, nc = kind == 0 ? n : n / 2 + 1;
+     int ni = kind == 1 ? n : 2 * nc, no = kind == 2 ? n : 2 * nc;
+     R *ibuf = (R *) X(malloc)(sizeof(R) * (ni + 1));
+     R *obuf = (R *) X(malloc)(sizeof(R) * (no + 1));
+     R *x = (R *) malloc(sizeof(R) * ni);
+     trigreal *xl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     X(plan) p;
+
+     flags |= FFTW_ALIGNMENT_VARIANTS;
+     switch (kind) {
+	 case 0:
+	      p = X(plan_dft_1d)(n, (C *) (ibuf + skewed),
+				 (C *) (obuf + skewed), FFTW_FORWARD, flags);
+	      break;
+	 case 1:
+	      p = X(plan_dft_r2c_1d)(n, ibuf + skewed, (C *) (obuf + skewed),
+				     flags);
+	      break;
+	 default:
+	      p = X(plan_dft_c2r_1d)(n, (C *) (ibuf + skewed), obuf + skewed,
+				     flags);
+	      break;
+     }
+     if (!p) {
+	  sprintf(what, "%s n=%d variants", nam[kind], n);
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (i = 0; i < ni; ++i) x[i] = rnd();
+     if (kind == 2) {
+	  /* a hermitian input */
+	  x[1] = 0;
+	  if (n % 2 == 0) x[n + 1] = 0;
+     }
+     for (k = 0; k < n; ++k) {
+	  switch (kind) {
+	      case 0:
+		   xl[2 * k] = x[2 * k]; xl[2 * k + 1] = x[2 * k + 1];
+		   break;
+	      case 1:
+		   xl[2 * k] = x[k]; xl[2 * k + 1] = 0;
+		   break;
+	      default:
+		   if (k < nc) {
+			xl[2 * k] = x[2 * k]; xl[2 * k + 1] = x[2 * k + 1];
+		   } else {
+			xl[2 * k] = x[2 * (n - k)];
+			xl[2 * k + 1] = -x[2 * (n - k) + 1];
+		   }
+		   break;
+	  }
+     }
+     dft(n, xl, yl, kind == 2 ? FFTW_BACKWARD : FFTW_FORWARD);
+     if (kind == 2)
+	  for (k = 0; k < n; ++k) yl[k] = yl[2 * k];
+
+     for (i = 0; i < 3; ++i) {
+	  R *in = ibuf + ioff[i], *out = obuf + ooff[i];
+
+	  memcpy(in, x, sizeof(R) * ni);
+	  switch (kind) {
+	      case 0: X(execute_dft)(p, (C *) in, (C *) out); break;
+	      case 1: X(execute_dft_r2c)(p, in, (C *) out); break;
+	      default: X(execute_dft_c2r)(p, (C *) in, out); break;
+	  }
+	  sprintf(what, "%s n=%d variants%s, %s -> %s", nam[kind], n,
+		  skewed ? " (skewed)" : "",
+		  ioff[i] ? "skewed" : "aligned",
+		  ooff[i] ? "skewed" : "aligned");
+	  check(what, kind == 2 ? rerr(yl, out, n) : cerr(yl, out, nc, 1),
+		TOL);
+     }
+     X(destroy_plan)(p);
+ done:
+     free(yl); free(xl); free(x);
+     X(free)(obuf); X(free)(ibuf);
+}
+
+static void check_variants(void)
+{
+     int kind;
+     for (kind = 0; kind < 3; ++kind) {
+	  variants1(kind, 30, 0, FFTW_ESTIMATE);
+	  variants1(kind, 64, 0, FFTW_MEASURE);
+	  variants1(kind, 17, 1, FFTW_ESTIMATE);
+	  variants1(kind, 256, 1, FFTW_MEASURE);
+     }
+}
+
+/*************************************************************/
+/* split and interleaved arrays */
+
+/* VL transforms of size N from split arrays to an interleaved one,
+   or from an interleaved array to split ones if !SPLITIN, computed
+   with the real and imaginary parts exchanged if BACKWARD.  With
+   VL == 1 the plan has no vector dimension. */
+static void split1(int n, int vl, int splitin, int backward, unsigned flags)
+{
+     char what[80];
+     int i, k, v;
+     R *sr = (R *) X(malloc)(sizeof(R) * n * vl);
+     R *si = (R *) X(malloc)(sizeof(R) * n * vl);
+     R *c = (R *) X(malloc)(sizeof(R) * 2 * n * vl);
+     R *y = (R *) malloc(sizeof(R) * 2 * n);
+     trigreal *xl = (trigreal *) malloc(sizeof(trigreal) * 2 * n * vl);
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     R *cr = c + backward, *ci = c + (1 - backward);
+     R *tr = backward ? si : sr, *ti = backward ? sr : si;
+     X(iodim) dim, vdim;
+     X(plan) p;
+
+     /* split arrays have unit stride, interleaved ones stride 2 */
+     dim.n = n;
+     dim.is = splitin ? 1 : 2;
+     dim.os = splitin ? 2 : 1;
+     vdim.n = vl;
+     vdim.is = splitin ? n : 2 * n;
+     vdim.os = splitin ? 2 * n : n;
+     sprintf(what, "split dft n=%d vl=%d %s%s%s", n, vl,
+	     splitin ? "split -> interleaved" : "interleaved -> split",
+	     backward ? " bwd" : "",
+	     (flags & FFTW_NO_BUFFERING) ? " nobuf" : "");
+
+     p = splitin
+	  ? X(plan_guru_split_dft)(1, &dim, vl > 1, &vdim,
+				   tr, ti, cr, ci, flags)
+	  : X(plan_guru_split_dft)(1, &dim, vl > 1, &vdim,
+				   cr, ci, tr, ti, flags);
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (i = 0; i < 2 * n * vl; ++i) xl[i] = rnd();
+     for (i = 0; i < n * vl; ++i) {
+	  sr[i] = c[2 * i] = (R) xl[2 * i];
+	  si[i] = c[2 * i + 1] = (R) xl[2 * i + 1];
+     }
+     if (splitin)
+	  X(execute_split_dft)(p, tr, ti, cr, ci);
+     else
+	  X(execute_split_dft)(p, cr, ci, tr, ti);
+
+     for (v = 0; v < vl; ++v) {
+	  dft(n, xl + 2 * n * v, yl, backward ? FFTW_BACKWARD : FFTW_FORWARD);
+	  for (k = 0; k < n; ++k) {
+	       if (splitin) {
+		    y[2 * k] = c[2 * (n * v + k)];
+		    y[2 * k + 1] = c[2 * (n * v + k) + 1];
+	       } else {
+		    y[2 * k] = sr[n * v + k];
+		    y[2 * k + 1] = si[n * v + k];
+	       }
+	  }
+	  check(what, cerr(yl, y, n, 1), TOL);
+     }
+     X(destroy_plan)(p);
+ done:
+     free(yl); free(xl); free(y);
+     X(free)(c); X(free)(si); X(free)(sr);
+}
+
+static void check_split(void)
+{
+     int splitin, backward;
+     for (splitin = 0; splitin < 2; ++splitin)
+	  for (backward = 0; backward < 2; ++backward) {
+	       split1(32, 1, splitin, backward, FFTW_ESTIMATE);
+	       split1(30, 3, splitin, backward, FFTW_ESTIMATE);
+	       split1(64, 1, splitin, backward,
+		      FFTW_ESTIMATE | FFTW_NO_BUFFERING);
+	       split1(12, 5, splitin, backward,
+		      FFTW_MEASURE | FFTW_NO_BUFFERING);
+	  }
+}
+
+/*************************************************************/
+/* transforms of fp16 and bf16 arrays */
+
+typedef unsigned short h16;
+
+/* the value of the 16-bit number H of format FMT; infinities and
+   NaNs do not occur here */
+static trigreal h16_val(h16 h, X(storage) fmt)
+{
+     if (fmt == FFTW_STORAGE_BF16) {
+	  unsigned u = (unsigned) h << 16;
+	  float f;
+	  memcpy(&f, &u, sizeof(f));
+	  return f;
+     } else {
+	  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+	  trigreal v = (e == 0) ? ldexpl((trigreal) m, -24)
+	       : ldexpl((trigreal) (m + 1024), e - 25);
+	  return (h & 0x8000) ? -v : v;
+     }
+}
+
+/* a random number of format FMT, of magnitude less than 1 */
+static h16 h16_rnd(X(storage) fmt)
+{
+     if (fmt == FFTW_STORAGE_BF16) {
+	  float f = (float) rnd();
+	  unsigned u;
+	  memcpy(&u, &f, sizeof(u));
+	  return (h16) (u >> 16);
+     } else {
+	  return (h16) (((rand() & 1) << 15) | ((9 + rand() % 6) << 10)
+			| (rand() & 0x3ff));
+     }
+}
+
+/* number K of the array A of format FMT */
+static trigreal num(const void *a, int k, X(storage) fmt)
+{
+     return (fmt == FFTW_STORAGE_NATIVE) ? (trigreal) ((const R *) a)[k]
+	  : h16_val(((const h16 *) a)[k], fmt);
+}
+
+static double storage_tol(X(storage) fmt)
+{
+     switch (fmt) {
+	 case FFTW_STORAGE_FP16: return 1e-3;
+	 case FFTW_STORAGE_BF16: return 1e-2;
+	 default: return TOL;
+     }
+}
+
+/* HOWMANY DFTs (KIND 0), R2Cs (1) or C2Rs (2) of size N from IFMT
+   to OFMT, with strides IS, OS and distances IDIST, ODIST in
+   elements, executed on new arrays if NEWARRAYS.  The reference is
+   computed from the numbers actually stored in the input, so that
+   the error is that of the rounding of the output to OFMT. */
+static void half1(int kind, int n, int howmany,
+		  int is, int idist, X(storage) ifmt,
+		  int os, int odist, X(storage) ofmt,
+		  int sign, int newarrays, unsigned flags)
+{
+     static const char *const nam[] = { "dft", "r2c", "c2r" };
+     static const char *const fnam[] = { "native", "fp16", "bf16" };
+     char what[96];
+     int mi = kind == 1 ? 1 : 2, mo = kind == 2 ? 1 : 2;
+     int nc = kind == 0 ? n : n / 2 + 1;
+     int ni = kind == 2 ? nc : n, no = kind == 1 ? nc : n;
+     int ilen = mi * ((howmany - 1) * idist + (ni - 1) * is + 1);
+     int olen = mo * ((howmany - 1) * odist + (no - 1) * os + 1);
+     size_t isz = ifmt == FFTW_STORAGE_NATIVE ? sizeof(R) : sizeof(h16);
+     size_t osz = ofmt == FFTW_STORAGE_NATIVE ? sizeof(R) : sizeof(h16);
+     char *in = (char *) X(malloc)(isz * ilen);
+     char *out = (char *) X(malloc)(osz * olen);
+     char *in2 = 0, *out2 = 0;
+     trigreal *xl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     trigreal *yl = (trigreal *) malloc(sizeof(trigreal) * 2 * n);
+     trigreal e = 0, m = 0;
+     int i, k, v;
+     X(plan) p;
+
+     sprintf(what, "%s n=%d howmany=%d %s -> %s%s", nam[kind], n, howmany,
+	     fnam[ifmt], fnam[ofmt], newarrays ? " new arrays" : "");
+     switch (kind) {
+	 case 0:
+	      p = X(plan_many_dft_half)(n, howmany, in, is, idist, ifmt,
+					out, os, odist, ofmt, sign, flags);
+	      break;
+	 case 1:
+	      p = X(plan_many_dft_r2c_half)(n, howmany, in, is, idist, ifmt,
+					    out, os, odist, ofmt, flags);
+	      break;
+	 default:
+	      p = X(plan_many_dft_c2r_half)(n, howmany, in, is, idist, ifmt,
+					    out, os, odist, ofmt, flags);
+	      break;
+     }
+     if (!p) {
+	  check_true(what, 0);
+	  goto done;
+     }
+
+     for (i = 0; i < ilen; ++i) {
+	  if (ifmt == FFTW_STORAGE_NATIVE)
+	       ((R *) in)[i] = rnd();
+	  else
+	       ((h16 *) in)[i] = h16_rnd(ifmt);
+     }
+     if (kind == 2) {
+	  /* hermitian inputs */
+	  for (v = 0; v < howmany; ++v) {
+	       int i0 = 2 * v * idist + 1, i1 = 2 * (v * idist + n / 2 * is) + 1;
+	       if (ifmt == FFTW_STORAGE_NATIVE) {
+		    ((R *) in)[i0] = 0;
+		    if (n % 2 == 0) ((R *) in)[i1] = 0;
+	       } else {
+		    ((h16 *) in)[i0] = 0;
+		    if (n % 2 == 0) ((h16 *) in)[i1] = 0;
+	       }
+	  }
+     }
+
+     if (newarrays) {
+	  in2 = (char *) X(malloc)(isz * ilen);
+	  out2 = (char *) X(malloc)(osz * olen);
+	  memcpy(in2, in, isz * ilen);
+	  X(execute_half)(p, in2, out2);
+	  memcpy(out, out2, osz * olen);
+     } else {
+	  X(execute)(p);
+     }
+
+     for (v = 0; v < howmany; ++v) {
+	  for (k = 0; k < n; ++k) {
+	       int j = (kind == 2 && k >= nc) ? n - k : k;
+	       int b = mi * (v * idist + j * is);
+	       xl[2 * k] = num(in, b, ifmt);
+	       xl[2 * k + 1] = (mi == 2) ? num(in, b + 1, ifmt) : 0;
+	       if (j != k) xl[2 * k + 1] = -xl[2 * k + 1];
+	  }
+	  dft(n, xl, yl, kind == 0 ? sign
+	      : (kind == 1 ? FFTW_FORWARD : FFTW_BACKWARD));
+	  for (k = 0; k < no; ++k) {
+	       int b = mo * (v * odist + k * os);
+	       trigreal d = fabsl(yl[2 * k] - num(out, b, ofmt));
+	       trigreal a = fabsl(yl[2 * k]);
+	       if (mo == 2) {
+		    d += fabsl(yl[2 * k + 1] - num(out, b + 1, ofmt));
+		    a += fabsl(yl[2 * k + 1]);
+	       }
+	       if (d > e) e = d;
+	       if (a > m) m = a;
+	  }
+     }
+     check(what, (double) (m > 0 ? e / m : e), storage_tol(ofmt));
+     X(destroy_plan)(p);
+ done:
+     free(yl); free(xl);
+     X(free)(out2); X(free)(in2); X(free)(out); X(free)(in);
+}
+
+static void check_half(void)
+{
+     const X(storage) F = FFTW_STORAGE_FP16, B = FFTW_STORAGE_BF16;
+     const X(storage) N = FFTW_STORAGE_NATIVE;
+     int kind;
+
+     for (kind = 0; kind < 3; ++kind) {
+	  int nc = kind == 0 ? 64 : 33;
+	  half1(kind, 64, 3, 1, kind == 1 ? 64 : nc, F,
+		1, kind == 2 ? 64 : nc, F, FFTW_FORWARD, 0, FFTW_ESTIMATE);
+	  half1(kind, 64, 3, 1, kind == 1 ? 64 : nc, B,
+		1, kind == 2 ? 64 : nc, B, FFTW_FORWARD, 0, FFTW_ESTIMATE);
+	  half1(kind, 15, 5, 2, 31, F, 3, 47, B, FFTW_BACKWARD, 0,
+		FFTW_ESTIMATE);
+	  half1(kind, 30, 4, 1, 40, B, 1, 40, F, FFTW_FORWARD, 1,
+		FFTW_MEASURE);
+	  half1(kind, 24, 2, 1, 32, F, 1, 32, N, FFTW_FORWARD, 0,
+		FFTW_ESTIMATE);
+	  half1(kind, 24, 2, 2, 50, N, 1, 32, B, FFTW_BACKWARD, 1,
+		FFTW_ESTIMATE);
+	  half1(kind, 1000, 2, 1, 1000, F, 1, 1000, F, FFTW_FORWARD, 0,
+		FFTW_ESTIMATE);
+     }
+}
+
+/*************************************************************/
+
+int main(int argc, char **argv)
+{
+     if (argc > 1 && !strcmp(argv[1], "-v"))
+	  verbose = 1;
+     srand(1);
+
+     check_ooc();
+     check_nufft();
+     check_czt();
+     check_stft();
+     check_fir();
+     check_mdct();
+     check_variants();
+     check_split();
+     check_half();
+
+     X(cleanup)();
+     if (failures)
+	  printf("%d API checks FAILED\n", failures);
+     return failures != 0;
+}
@@ -182,6 +182,22 @@ sub small_0d {
     }
 }
 
+# transposes large enough for the SIMD transpose solvers, in place
+# (square) and out of place, and copies above the size at which
+# rdft-rank0-nt streams its output (2 MB).  With --paranoid every plan
+# the planner considers for them is verified, not only the winner.
+sub large_0d {
+    foreach $n (33, 64) {
+	do_problem("i1v${n}:1:${n}x${n}:${n}:1", 1);
+	do_problem("o1v${n}:1:${n}x${n}:${n}:1", 1);
+	do_problem("o1v${n}:1:48x48:${n}:1", 1);
+	do_problem("i1v${n}:1:48x48:${n}:1", 1);
+    }
+    do_problem("ok1v524288", 1);
+    do_problem("o1v262144", 1);
+    do_problem("ok1v1024:512:1x512:1:1024", 1);
+}
+
 sub small_1d {
     do_size (0, 0);
     for ($i = 1; $i <= 100; ++$i) {
@@ -324,6 +340,7 @@ sub parse_arguments (@)
 
 &random_tests if $do_random;
 &small_0d if $do_0d;
+&large_0d if $do_0d;
 &small_1d if $do_1d;
 &small_2d if $do_2d;
 
@@ -215,6 +215,8 @@ static void hook(planner *plnr, plan *pln, const problem *p_, int optimalp)
 	       the_plan = (apiplan *) MALLOC(sizeof(apiplan), PLANS);
 	       the_plan->pln = pln;
 	       the_plan->prb = (problem *) p_;
+	       the_plan->pln_unaligned = 0;
+	       the_plan->prb_unaligned = 0;
 
 	       X(plan_awake)(pln, AWAKE_SQRTN_TABLE);
 	       verify_problem(bp, rounds, tol);
@@ -27,12 +27,14 @@ static void threads_register_hooks(void)
 {
      X(mksolver_ct_hook) = X(mksolver_ct_threads);
      X(mksolver_hc2hc_hook) = X(mksolver_hc2hc_threads);
+     X(nufft_spawn_hook) = X(nufft_spawn_threads);
 }
 
 static void threads_unregister_hooks(void)
 {
      X(mksolver_ct_hook) = 0;
      X(mksolver_hc2hc_hook) = 0;
+     X(nufft_spawn_hook) = 0;
 }
 
 /* should be called before all other FFTW functions! */
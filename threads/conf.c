@@ -21,16 +21,33 @@
 
 #include "threads/threads.h"
 
-static const solvtab s =
+static const solvtab sdft =
 {
      SOLVTAB(X(dft_thr_vrank_geq1_register)),
+     SOLVTAB_END
+};
+
+static const solvtab srdft =
+{
      SOLVTAB(X(rdft_thr_vrank_geq1_register)),
-     SOLVTAB(X(rdft2_thr_vrank_geq1_register)),
+     SOLVTAB_END
+};
 
+static const solvtab srdft2 =
+{
+     SOLVTAB(X(rdft2_thr_vrank_geq1_register)),
      SOLVTAB_END
 };
 
+static void conf_dft(planner *p) { X(solvtab_exec)(sdft, p); }
+static void conf_rdft(planner *p) { X(solvtab_exec)(srdft, p); }
+static void conf_rdft2(planner *p) { X(solvtab_exec)(srdft2, p); }
+
+/* one table per problem kind, so that each is registered after the
+   standard solvers of its kind whatever kind is planned first */
 void X(threads_conf_standard)(planner *p)
 {
-     X(solvtab_exec)(s, p);
+     X(planner_defer)(p, conf_dft, PROBLEM_KIND_BIT(PROBLEM_DFT));
+     X(planner_defer)(p, conf_rdft, PROBLEM_KIND_BIT(PROBLEM_RDFT));
+     X(planner_defer)(p, conf_rdft2, PROBLEM_KIND_BIT(PROBLEM_RDFT2));
 }
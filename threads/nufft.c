@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2003, 2007-14 Matteo Frigo
+ * Copyright (c) 2003, 2007-14 Massachusetts Institute of Technology
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "threads/threads.h"
+
+/* run the spreading and interpolation loops of dft/nufft.c in
+   parallel; installed as X(nufft_spawn_hook) */
+
+typedef struct {
+     void (*work)(void *, int);
+     void *data;
+} WD;
+
+static void *spawn_apply(spawn_data *d)
+{
+     WD *ego = (WD *) d->data;
+     ego->work(ego->data, d->thr_num);
+     return 0;
+}
+
+void X(nufft_spawn_threads)(int nthr, void (*work)(void *, int), void *data)
+{
+     WD d;
+     d.work = work;
+     d.data = data;
+     X(spawn_loop)(nthr, nthr, spawn_apply, (void *) &d);
+}
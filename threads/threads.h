@@ -51,6 +51,7 @@ ct_solver *X(mksolver_ct_threads)(size_t size, INT r, int dec,
 				  ct_mkinferior mkcldw,
 				  ct_force_vrecursion force_vrecursionp);
 hc2hc_solver *X(mksolver_hc2hc_threads)(size_t size, INT r, hc2hc_mkinferior mkcldw);
+void X(nufft_spawn_threads)(int nthr, void (*work)(void *, int), void *data);
 
 void X(threads_conf_standard)(planner *p);
 void X(threads_register_hooks)(void);
@@ -0,0 +1,75 @@
+# CMake version of fftw-wisdom-to-conf, for builds without a Unix shell:
+#
+#   cmake -DWISDOM=<wisdom file> -DOUTPUT=<C file> \
+#         -DPACKAGE=fftw -DVERSION=<version> -P fftw-wisdom-to-conf.cmake
+#
+# writes the configuration routine that registers exactly the solvers
+# named in the wisdom.  Solvers of the threads library (*_thr_*) are
+# left out, since the threads library registers them itself.
+
+if (NOT WISDOM OR NOT OUTPUT OR NOT PACKAGE OR NOT VERSION)
+  message (FATAL_ERROR "usage: cmake -DWISDOM=file -DOUTPUT=file "
+                       "-DPACKAGE=name -DVERSION=version -P ${CMAKE_CURRENT_LIST_FILE}")
+endif ()
+
+file (STRINGS ${WISDOM} lines)
+list (LENGTH lines nlines)
+if (nlines EQUAL 0)
+  message (FATAL_ERROR "fftw-wisdom-to-conf: invalid wisdom ${WISDOM}")
+endif ()
+
+# the first line is "(fftw-3.3.10 fftw_wisdom", where the prefix of
+# the wisdom name is that of the library
+list (GET lines 0 header)
+if (NOT header MATCHES "^\\(([^ ]+) ([A-Za-z0-9]+)_wisdom"
+    OR NOT CMAKE_MATCH_1 STREQUAL "${PACKAGE}-${VERSION}")
+  message (FATAL_ERROR "fftw-wisdom-to-conf: invalid wisdom ${WISDOM}")
+endif ()
+set (prefix "${CMAKE_MATCH_2}_")
+list (REMOVE_AT lines 0)
+
+# every other line starts with the registration name of a solver
+set (names)
+foreach (line ${lines})
+  if (line MATCHES "^ *\\(([^ ()]+)")
+    set (nam "${CMAKE_MATCH_1}")
+    if (NOT nam MATCHES "-" AND NOT nam MATCHES "_thr_")
+      list (APPEND names "${nam}")
+    endif ()
+  endif ()
+endforeach ()
+if (names)
+  list (REMOVE_DUPLICATES names)
+  list (SORT names)
+endif ()
+
+set (do "")
+foreach (nam ${names})
+  string (APPEND do "    X(${nam})\\\n")
+endforeach ()
+
+file (WRITE ${OUTPUT}
+"/* Automatically generated by fftw-wisdom-to-conf from ${PACKAGE} ${VERSION}.
+   DO NOT EDIT!  (Unless you really, really want to.  Then it's okay.) */
+void ${prefix}configure_planner(void *plnr)
+{
+    struct solvtab_s { void (*reg)(void *); const char *reg_nam; };
+    extern void ${prefix}solvtab_exec(const struct solvtab_s s[], void *);
+
+#define DECLARE(name) extern void name(void *);
+#define STRINGIZEx(x) #x
+#define STRINGIZE(x) STRINGIZEx(x)
+#define SOLVTAB(s) { s, STRINGIZE(s) },
+#define DO(X) \\
+${do}    /* end DO(X) */
+
+    DO(DECLARE)
+
+    const struct solvtab_s s[] = {
+        DO(SOLVTAB)
+        { 0, 0 }
+    };
+
+    ${prefix}solvtab_exec(s, plnr);
+}
+")